@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+/**
+ * Benchmarks of the individual equivalence checkers and application schemes on
+ * the RevLib circuits (and their compiled counterparts) bundled with the tests.
+ *
+ * Besides the wall time of a complete check (preprocessing included), every
+ * benchmark reports the average preprocessing and checking time as well as the
+ * peak number of active nodes as counters. Use
+ * `--benchmark_out=<file> --benchmark_out_format=json` to obtain the results in
+ * a machine-readable form, e.g., for comparing them across releases via
+ * Google Benchmark's `compare.py`.
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "qasm3/Importer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <string>
+
+namespace {
+enum class Checker : std::uint8_t { Alternating, Construction, Simulation, ZX };
+
+std::string toString(const Checker checker) {
+  switch (checker) {
+  case Checker::Alternating:
+    return "alternating";
+  case Checker::Construction:
+    return "construction";
+  case Checker::Simulation:
+    return "simulation";
+  default:
+    return "zx";
+  }
+}
+
+constexpr std::array CHECKERS{Checker::Alternating, Checker::Construction,
+                              Checker::Simulation, Checker::ZX};
+
+constexpr std::array SCHEMES{
+    ec::ApplicationSchemeType::Sequential, ec::ApplicationSchemeType::OneToOne,
+    ec::ApplicationSchemeType::Lookahead, ec::ApplicationSchemeType::GateCost,
+    ec::ApplicationSchemeType::Proportional};
+
+// circuits with a transpiled counterpart that can be checked within seconds
+constexpr std::array CIRCUITS{
+    "dk27_225", "pcler8_248", "5xp1_194",   "alu1_198", "dk17_224",
+    "cu_219",   "c2_181",     "rd73_312",   "c2_182",   "cm163a_213",
+    "sym9_317", "rd84_313",   "mod5adder_306"};
+
+const std::string CIRCUITS_DIR = MQT_QCEC_CIRCUITS_DIR;
+
+bool supports(const Checker checker, const ec::ApplicationSchemeType scheme) {
+  // the lookahead scheme only makes sense for the alternating checker
+  return scheme != ec::ApplicationSchemeType::Lookahead ||
+         checker == Checker::Alternating;
+}
+
+ec::Configuration configure(const Checker checker,
+                            const ec::ApplicationSchemeType scheme) {
+  ec::Configuration config{};
+  config.execution.parallel = false;
+  config.execution.runAlternatingChecker = checker == Checker::Alternating;
+  config.execution.runConstructionChecker = checker == Checker::Construction;
+  config.execution.runSimulationChecker = checker == Checker::Simulation;
+  config.execution.runZXChecker = checker == Checker::ZX;
+  config.application.alternatingScheme = scheme;
+  config.application.constructionScheme = scheme;
+  config.application.simulationScheme = scheme;
+  // make the simulations reproducible
+  config.simulation.seed = 12345U;
+  return config;
+}
+
+void benchmarkChecker(benchmark::State& state, const std::string& circuit,
+                      const Checker checker,
+                      const ec::ApplicationSchemeType scheme) {
+  const auto original =
+      qasm3::Importer::importf(CIRCUITS_DIR + "/original/" + circuit + ".qasm");
+  const auto transpiled = qasm3::Importer::importf(
+      CIRCUITS_DIR + "/transpiled/" + circuit + "_transpiled.qasm");
+  const auto config = configure(checker, scheme);
+
+  double preprocessingTime = 0.;
+  double checkTime = 0.;
+  std::size_t maxNodes = 0U;
+  for (auto _ : state) {
+    ec::EquivalenceCheckingManager ecm(original, transpiled, config);
+    ecm.run();
+
+    const auto& results = ecm.getResults();
+    if (results.equivalence == ec::EquivalenceCriterion::NotEquivalent) {
+      state.SkipWithError("circuits have not been found to be equivalent");
+      break;
+    }
+    preprocessingTime += results.preprocessingTime;
+    checkTime += results.checkTime;
+    for (const auto& checkerResults : results.checkerResults) {
+      if (checkerResults.contains("max_nodes")) {
+        maxNodes = std::max(maxNodes,
+                            checkerResults["max_nodes"].get<std::size_t>());
+      }
+    }
+  }
+
+  state.counters["preprocessing_time"] =
+      benchmark::Counter(preprocessingTime, benchmark::Counter::kAvgIterations);
+  state.counters["check_time"] =
+      benchmark::Counter(checkTime, benchmark::Counter::kAvgIterations);
+  state.counters["max_nodes"] = static_cast<double>(maxNodes);
+}
+
+void registerBenchmarks() {
+  for (const auto& circuit : CIRCUITS) {
+    for (const auto checker : CHECKERS) {
+      if (checker == Checker::ZX) {
+        // the ZX checker does not use any application scheme
+        const auto name = toString(checker) + "/" + circuit;
+        benchmark::RegisterBenchmark(name.c_str(), benchmarkChecker,
+                                     std::string(circuit), checker,
+                                     ec::ApplicationSchemeType::Proportional)
+            ->Unit(benchmark::kMillisecond)
+            ->UseRealTime();
+        continue;
+      }
+      for (const auto scheme : SCHEMES) {
+        if (!supports(checker, scheme)) {
+          continue;
+        }
+        const auto name =
+            toString(checker) + "/" + ec::toString(scheme) + "/" + circuit;
+        benchmark::RegisterBenchmark(name.c_str(), benchmarkChecker,
+                                     std::string(circuit), checker, scheme)
+            ->Unit(benchmark::kMillisecond)
+            ->UseRealTime();
+      }
+    }
+  }
+}
+} // namespace
+
+int main(int argc, char** argv) {
+  registerBenchmarks();
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
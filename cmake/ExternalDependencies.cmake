@@ -67,6 +67,22 @@ if(BUILD_MQT_QCEC_TESTS)
   list(APPEND FETCH_PACKAGES googletest)
 endif()
 
+if(BUILD_MQT_QCEC_BENCHMARKS)
+  set(BENCHMARK_ENABLE_TESTING
+      OFF
+      CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_INSTALL
+      OFF
+      CACHE BOOL "" FORCE)
+  set(BENCHMARK_VERSION
+      1.9.1
+      CACHE STRING "Google Benchmark version")
+  set(BENCHMARK_URL
+      https://github.com/google/benchmark/archive/refs/tags/v${BENCHMARK_VERSION}.tar.gz)
+  FetchContent_Declare(benchmark URL ${BENCHMARK_URL} FIND_PACKAGE_ARGS NAMES benchmark)
+  list(APPEND FETCH_PACKAGES benchmark)
+endif()
+
 if(BUILD_MQT_QCEC_BINDINGS)
   # add pybind11_json library
   FetchContent_Declare(
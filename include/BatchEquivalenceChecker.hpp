@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "ThreadPool.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief Checks the equivalence of many pairs of circuits.
+ * @details All pairs are checked with the same configuration. The checks are
+ * scheduled on a pool of min(`execution.nthreads`, #pairs) workers. If there
+ * are at least as many pairs as threads, every pair is checked sequentially on
+ * one worker. Otherwise, the threads are distributed among the pairs: for
+ * every pair that is checked at once, a pool of `nthreads / #pairs` threads is
+ * created once per run, and the check of a pair leases one of these pools for
+ * the checkers of its parallel flow. In this case, the worker that runs the
+ * check of a pair merely waits for the pair's checkers. Hence, at most
+ * `execution.nthreads` threads are busy checking at any time (independent of
+ * the number of pairs), while up to `2 * execution.nthreads` threads exist
+ * during a run.
+ *
+ * Each result is reported to an (optional) callback as soon as the
+ * corresponding check has finished. Managers that produced a counterexample
+ * are kept alive (so that the counterexample's decision diagrams stay valid)
+ * until the batch is cleared or destroyed. All other managers are released
+ * right after their check.
+ */
+class BatchEquivalenceChecker {
+public:
+  using Results = EquivalenceCheckingManager::Results;
+  /// Called with the index of a pair and its results once the pair has been
+  /// checked. Calls are serialized, but may happen on any worker thread.
+  using ResultCallback = std::function<void(std::size_t, const Results&)>;
+
+  explicit BatchEquivalenceChecker(Configuration config = Configuration{})
+      : configuration(std::move(config)) {}
+
+  /// \brief Add a pair of circuits to the batch.
+  /// \details The circuits are not copied and must stay alive until the batch
+  /// has been run.
+  /// \return The index of the pair within the batch.
+  std::size_t addPair(const qc::QuantumComputation& circ1,
+                      const qc::QuantumComputation& circ2);
+
+  /// Check all pairs of the batch
+  void run(const ResultCallback& onResult = {});
+
+  /// Remove all pairs and results from the batch
+  void clear();
+
+  [[nodiscard]] std::size_t size() const noexcept { return pairs.size(); }
+
+  /// Returns the results of the pair with the given index (after `run`)
+  [[nodiscard]] const Results& getResults(const std::size_t index) const {
+    return results.at(index);
+  }
+  [[nodiscard]] const std::vector<Results>& getResults() const noexcept {
+    return results;
+  }
+
+  /// Use the given pool for scheduling the checks instead of creating one
+  void setThreadPool(std::shared_ptr<ThreadPool> pool) {
+    threadPool = std::move(pool);
+  }
+  [[nodiscard]] auto getThreadPool() const -> const auto& {
+    return threadPool;
+  }
+
+  /// Returns a mutable reference to the used configuration
+  [[nodiscard]] auto getConfiguration() -> auto& { return configuration; }
+
+private:
+  Configuration configuration;
+  std::shared_ptr<ThreadPool> threadPool;
+
+  std::vector<
+      std::pair<const qc::QuantumComputation*, const qc::QuantumComputation*>>
+      pairs;
+  std::vector<Results> results;
+  // managers whose results contain a counterexample
+  std::vector<std::unique_ptr<EquivalenceCheckingManager>> managers;
+};
+} // namespace ec
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief A bounded multi-producer/single-consumer channel.
+ * @details Values are passed through a fixed-size ring buffer in which every
+ * slot carries a sequence number that tells producers and the consumer whether
+ * the slot is free or holds a value. Pushing and popping are lock-free and
+ * never allocate. Only if the consumer has to block (because the channel is
+ * empty), it falls back to a condition variable, which producers only notify
+ * if the consumer is actually waiting.
+ *
+ * The channel is meant for passing small values (e.g., ids of finished tasks)
+ * to a coordinating thread. Its capacity should be at least the number of
+ * values that can be in flight at the same time. Producers that find the
+ * channel full yield until the consumer has made room.
+ *
+ * Only a single thread may pop values at any time.
+ */
+template <typename T> class CompletionChannel {
+public:
+  /// \param minCapacity The minimum number of values the channel can hold
+  /// (rounded up to the next power of two).
+  explicit CompletionChannel(const std::size_t minCapacity)
+      : slots(roundUpToPowerOfTwo(minCapacity)), mask(slots.size() - 1U) {
+    for (std::size_t i = 0U; i < slots.size(); ++i) {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  CompletionChannel(const CompletionChannel& other) = delete;
+
+  CompletionChannel& operator=(const CompletionChannel& other) = delete;
+
+  void push(T value) {
+    auto pos = tail.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+      slot = &slots[pos & mask];
+      const auto seq = slot->sequence.load(std::memory_order_acquire);
+      const auto diff =
+          static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+      if (diff == 0) {
+        // the slot is free, try to claim it
+        if (tail.compare_exchange_weak(pos, pos + 1U,
+                                       std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // the channel is full, wait for the consumer to make room
+        std::this_thread::yield();
+        pos = tail.load(std::memory_order_relaxed);
+      } else {
+        // another producer claimed the slot in the meantime
+        pos = tail.load(std::memory_order_relaxed);
+      }
+    }
+    slot->value = std::move(value);
+    slot->sequence.store(pos + 1U, std::memory_order_release);
+
+    // pairs with the fence in `waitAndPopUntil`/`waitAndPop` so that either the
+    // consumer sees the value or the producer sees the waiting consumer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (consumerWaiting.load(std::memory_order_relaxed)) {
+      const std::lock_guard lock(waitMutex);
+      dataCond.notify_one();
+    }
+  }
+
+  /// Pop a value if one is available (consumer only)
+  std::optional<T> tryPop() {
+    auto& slot = slots[head & mask];
+    if (slot.sequence.load(std::memory_order_acquire) != head + 1U) {
+      return std::nullopt;
+    }
+    std::optional<T> value{std::move(slot.value)};
+    // hand the slot back to the producers for the next round
+    slot.sequence.store(head + mask + 1U, std::memory_order_release);
+    ++head;
+    return value;
+  }
+
+  /// Wait until a value is available and pop it (consumer only)
+  T waitAndPop() {
+    if (auto value = spinPop()) {
+      return std::move(*value);
+    }
+    std::unique_lock lock(waitMutex);
+    announceWaiting(true);
+    std::optional<T> value{};
+    dataCond.wait(lock, [&] {
+      value = tryPop();
+      return value.has_value();
+    });
+    announceWaiting(false);
+    return std::move(*value);
+  }
+
+  /// Wait until a value is available or the given point in time has been
+  /// reached. Returns `std::nullopt` in the latter case (consumer only).
+  template <typename Clock, typename Dur>
+  std::optional<T>
+  waitAndPopUntil(const std::chrono::time_point<Clock, Dur>& timepoint) {
+    if (auto value = spinPop()) {
+      return value;
+    }
+    std::unique_lock lock(waitMutex);
+    announceWaiting(true);
+    std::optional<T> value{};
+    dataCond.wait_until(lock, timepoint, [&] {
+      value = tryPop();
+      return value.has_value();
+    });
+    announceWaiting(false);
+    return value;
+  }
+
+  [[nodiscard]] std::size_t capacity() const noexcept { return slots.size(); }
+
+private:
+  struct Slot {
+    std::atomic<std::size_t> sequence{};
+    T value{};
+  };
+
+  // number of attempts to pop a value before blocking
+  static constexpr std::size_t SPIN_ATTEMPTS = 64U;
+
+  std::vector<Slot> slots;
+  std::size_t mask;
+
+  // keep the producers' and the consumer's position on separate cache lines
+  alignas(64) std::atomic<std::size_t> tail{0U};
+  alignas(64) std::size_t head{0U};
+
+  std::atomic<bool> consumerWaiting{false};
+  std::mutex waitMutex;
+  std::condition_variable dataCond;
+
+  static std::size_t roundUpToPowerOfTwo(const std::size_t n) {
+    std::size_t capacity = 1U;
+    while (capacity < n) {
+      capacity <<= 1U;
+    }
+    return capacity;
+  }
+
+  std::optional<T> spinPop() {
+    for (std::size_t i = 0U; i < SPIN_ATTEMPTS; ++i) {
+      if (auto value = tryPop()) {
+        return value;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void announceWaiting(const bool waiting) {
+    consumerWaiting.store(waiting, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+};
+} // namespace ec
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "checker/dd/GarbageCollectionPolicy.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
 #include "checker/dd/simulation/StateType.hpp"
@@ -22,6 +23,7 @@
 #include <nlohmann/json_fwd.hpp>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace ec {
 
@@ -32,6 +34,8 @@ public:
     dd::fp numericalTolerance = dd::RealNumber::eps;
 
     bool parallel = true;
+    // maximum number of threads used by a check (including the threads that
+    // checkers which split up their work borrow from the manager)
     std::size_t nthreads = std::max(2U, std::thread::hardware_concurrency());
     double timeout = 0.; // in seconds
 
@@ -39,6 +43,46 @@ public:
     bool runSimulationChecker = true;
     bool runAlternatingChecker = true;
     bool runZXChecker = true;
+    // maximum number of gate DDs cached per package (0 disables the cache)
+    std::size_t gateCacheSize = 0U;
+    // when to collect garbage while applying gates
+    GarbageCollectionPolicy gcPolicy = GarbageCollectionPolicy::Always;
+    // number of gates in between two collections (periodic policy)
+    std::size_t gcInterval = 64U;
+    // maximum unique table entries per bucket (load factor policy)
+    double gcLoadFactor = 2.0;
+    // maximum memory of the nodes and compute tables in MiB (high water mark
+    // policy)
+    std::size_t gcHighWaterMark = 1024U;
+    // maximum memory (in MiB) a decision diagram checker may use for its nodes
+    // and compute tables before it gives up (0 means unlimited)
+    std::size_t memoryBudget = 0U;
+    // tune the table sizes of the decision diagram packages to the checkers
+    // and the size of the circuits (opt-in, since it changes the tables of
+    // every checker)
+    bool adaptiveTableSizing = false;
+    // number of buckets of the primary unique/compute tables of the decision
+    // diagram packages (0 means automatic, rounded up to a power of two)
+    std::size_t uniqueTableBuckets = 0U;
+    std::size_t computeTableBuckets = 0U;
+    // time (in seconds) that checkers are granted to react to a cancellation
+    // in the parallel flow before `run()` returns without them (0 means
+    // waiting for all checkers to stop)
+    double cancellationGracePeriod = 0.;
+    // once all simulations are done, run alternating checkers with further
+    // application schemes in the freed threads of the parallel flow
+    bool reassignIdleThreads = false;
+    // number of contiguous segments per circuit whose functionality is
+    // constructed concurrently by the construction checker (1 constructs the
+    // functionality sequentially)
+    std::size_t constructionSegments = 1U;
+    // split the alternating check into independent sub-miters at points where
+    // both circuits are structurally synchronized and check them concurrently
+    bool splitMiters = false;
+    // number of threads the ZX checker uses to search for matches of its
+    // simplification rules (1 searches sequentially). The additional threads
+    // are borrowed from the manager and count towards `nthreads`.
+    std::size_t zxThreads = 1U;
   };
 
   // configuration options for pre-check optimizations
@@ -60,6 +104,23 @@ public:
         ApplicationSchemeType::Proportional;
     ApplicationSchemeType alternatingScheme =
         ApplicationSchemeType::Proportional;
+    // application schemes raced by concurrent alternating checkers in the
+    // parallel flow (the first definitive result wins). If empty, only the
+    // `alternatingScheme` is used.
+    std::vector<ApplicationSchemeType> alternatingPortfolio;
+    // number of gates at the front (and back) of both circuits that the
+    // alternating checker searches for matching gates that structurally cancel
+    // before any decision diagram is constructed (0 disables the search)
+    std::size_t cancellationWindow = 0U;
+
+    // options for the lookahead application scheme
+    // number of operations the search looks ahead
+    std::size_t lookaheadDepth = 1U;
+    // maximum number of states kept per step of the search (0 means all)
+    std::size_t lookaheadBeamWidth = 0U;
+    // compare upper bounds on the sizes of the resulting decision diagrams
+    // instead of constructing them
+    bool lookaheadSizeEstimate = false;
 
     // options for the gate cost application scheme
     std::string profile;
@@ -79,6 +140,11 @@ public:
     std::size_t maxSims = computeMaxSims();
     StateType stateType = StateType::ComputationalBasis;
     std::size_t seed = 0U;
+    // in the parallel flow, let every simulation thread keep its checker (and
+    // decision diagram package) alive and process a stream of stimuli
+    bool persistentWorkers = false;
+    // number of stimuli simulated together in lock-step by a single checker
+    std::size_t batchSize = 1U;
 
     // this function makes sure that the maximum number of simulations is
     // configured properly.
@@ -94,6 +160,13 @@ public:
       return std::max(defaultMaxSims,
                       systemThreads - defaultConfiguredOtherCheckers);
     }
+    // adaptively determine the number of stimuli in the parallel flow. Starting
+    // with `initialSims` stimuli, the number is doubled (up to `maxSims`) as
+    // long as further simulations are expected to pay off. Ignored (with a
+    // warning) if `persistentWorkers` is set, since the workers process all
+    // `maxSims` stimuli.
+    bool adaptiveSims = false;
+    std::size_t initialSims = 4U;
   };
 
   struct Parameterized {
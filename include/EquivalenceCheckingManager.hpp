@@ -10,20 +10,30 @@
 
 #pragma once
 
+#include "CompletionChannel.hpp"
 #include "Configuration.hpp"
 #include "EquivalenceCriterion.hpp"
-#include "ThreadSafeQueue.hpp"
+#include "NumericalToleranceLock.hpp"
+#include "StopToken.hpp"
+#include "ThreadPool.hpp"
 #include "checker/EquivalenceChecker.hpp"
+#include "checker/dd/DDAlternatingChecker.hpp"
+#include "checker/dd/DDBatchSimulationChecker.hpp"
 #include "checker/dd/DDSimulationChecker.hpp"
+#include "checker/dd/MiterSplittingChecker.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
 #include "checker/dd/simulation/StateGenerator.hpp"
 #include "dd/Node.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <exception>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -31,6 +41,8 @@
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace ec {
@@ -45,11 +57,21 @@ public:
 
     std::size_t startedSimulations = 0U;
     std::size_t performedSimulations = 0U;
+    // whether the simulations have been stopped early because a simulation
+    // exceeded its memory budget
+    bool simulationsAborted = false;
     dd::VectorDD cexInput{};
     dd::VectorDD cexOutput1{};
     dd::VectorDD cexOutput2{};
     std::size_t performedInstantiations = 0U;
 
+    // decisions taken by the adaptive stimulus count (if enabled)
+    nlohmann::json simulationDecisions = nlohmann::json::array();
+
+    // application schemes of the alternating checkers raced against each
+    // other and the winning scheme (if more than one scheme has been used)
+    nlohmann::json alternatingPortfolio{};
+
     nlohmann::json checkerResults = nlohmann::json::array();
 
     [[nodiscard]] bool consideredEquivalent() const {
@@ -75,10 +97,20 @@ public:
                              const qc::QuantumComputation& circ2,
                              Configuration config = Configuration{});
 
+  ~EquivalenceCheckingManager();
+
+  EquivalenceCheckingManager(const EquivalenceCheckingManager&) = delete;
+  EquivalenceCheckingManager&
+  operator=(const EquivalenceCheckingManager&) = delete;
+
   void run();
 
   void reset() {
+    joinAbandonedTasks();
     stateGenerator.clear();
+    stimuli.clear();
+    nextStimulus = 0U;
+    simulationRuns.clear();
     results = Results();
     checkers.clear();
   }
@@ -87,6 +119,25 @@ public:
     return results.equivalence;
   }
 
+  /**
+   * @brief Set the thread pool used for running checkers in parallel.
+   * @details This allows sharing a single, long-lived pool of worker threads
+   * between multiple EquivalenceCheckingManager instances. If no pool is set,
+   * the manager creates its own pool upon the first parallel check and keeps
+   * it alive for subsequent runs. A pool with fewer threads than requested by
+   * the configuration is used as is.
+   * @param pool The thread pool to use.
+   */
+  void setThreadPool(std::shared_ptr<ThreadPool> pool) {
+    threadPool = std::move(pool);
+    ownsThreadPool = false;
+  }
+
+  /// Returns the thread pool used for parallel checks (if any)
+  [[nodiscard]] auto getThreadPool() const -> const auto& {
+    return threadPool;
+  }
+
   /// Returns a mutable reference to the used configuration
   [[nodiscard]] auto getConfiguration() -> auto& { return configuration; }
 
@@ -168,10 +219,46 @@ protected:
   StateGenerator stateGenerator;
   std::mutex stateGeneratorMutex;
 
+  // stimuli drawn upfront for the persistent simulation workers. Workers claim
+  // the next stimulus by atomically advancing `nextStimulus`.
+  std::vector<Stimulus> stimuli;
+  std::atomic<std::size_t> nextStimulus{0U};
+  // set once a simulation exceeded its memory budget. The remaining
+  // simulations would most likely exceed it as well, so no further
+  // simulations are started.
+  std::atomic<bool> simulationAborted{false};
+  // number of simulations accounted for by the task in the respective slot
+  std::vector<std::size_t> simulationRuns;
+  // number of simulations to be conducted (less than the configured maximum
+  // if the number of stimuli is determined adaptively)
+  std::size_t simulationLimit{};
+  // the running alternating checkers (including miter splitting checkers) of
+  // the current parallel run (by slot). Several of them run at once if a
+  // portfolio is raced or idle slots are reassigned.
+  std::vector<std::atomic<const EquivalenceChecker*>> alternatingCheckers;
+
   bool done{false};
   std::condition_variable doneCond;
   std::mutex doneMutex;
+  // a fresh source is used for every run so that tasks abandoned in a previous
+  // run can never be revived
+  StopSource stopSource;
   std::vector<std::unique_ptr<EquivalenceChecker>> checkers;
+  // tasks (and the slot of their checker) that did not stop within the
+  // cancellation grace period of a parallel check
+  std::vector<std::pair<std::size_t, std::future<void>>> abandonedTasks;
+
+  std::shared_ptr<ThreadPool> threadPool;
+  bool ownsThreadPool{true};
+
+  // called by the tasks of the parallel flow (with their slot and stop token)
+  // right before their checker is run. Allows tests to emulate checkers that
+  // are slow to react to cancellations.
+  std::function<void(std::size_t, const StopToken&)> taskHook;
+
+  // the lock on the numerical tolerance held during a run (shared with the
+  // tasks started in that run)
+  std::weak_ptr<const NumericalToleranceLock> toleranceLock;
 
   Results results{};
 
@@ -209,6 +296,7 @@ protected:
   /// possible since a result has been determined
   void setAndSignalDone() {
     done = true;
+    stopSource.requestStop();
     for (const auto& checker : checkers) {
       if (checker) {
         checker->signalDone();
@@ -216,29 +304,76 @@ protected:
     }
   }
 
+  // channel through which tasks report the slot of their checker once done
+  using CompletionQueue = CompletionChannel<std::size_t>;
+
+  /// Let a checker of the sequential flow that can put the given number of
+  /// threads to use run parts of its computation on the manager's thread pool
+  /// (within the configured number of threads)
+  void lendThreadPool(EquivalenceChecker& checker, std::size_t parallelism);
+
+  /// Wait for the given tasks to finish after a stop has been requested. Tasks
+  /// that do not finish within the configured cancellation grace period are
+  /// moved to `abandonedTasks`.
+  void awaitTasks(std::vector<std::future<void>>& tasks);
+
+  /// Wait for all tasks abandoned in a previous parallel check
+  void joinAbandonedTasks();
+
+  [[nodiscard]] bool isAbandoned(std::size_t slot) const;
+
   /// \brief Run an EquivalenceChecker asynchronously
   ///
-  /// This function is used to asynchronously run an EquivalenceChecker. It also
+  /// This function is used to asynchronously run an EquivalenceChecker on the
+  /// manager's thread pool. It also
   /// takes care of creating the checker if it does not exist yet. Additionally,
   /// it takes care that the checker signals the main thread when it is done
-  /// (even in case of an exception).
+  /// (even in case of an exception). The task only references the queue via
+  /// shared ownership and observes the stop token of the current run, so that
+  /// it may safely outlive the parallel check it has been started from.
   ///
   /// \tparam Checker The type of the checker (must be derived from the
   /// EquivalenceChecker class).
   /// \param id The id in the checkers vector where the checker is stored.
   /// \param queue The queue to which the checker shall push its id
   /// once it is done.
+  /// \param config The configuration to create the checker with (if it does
+  /// not exist yet). Defaults to the manager's configuration.
   /// \return A future that can be used to wait for the checker to finish.
   template <class Checker>
-  std::future<void> asyncRunChecker(const std::size_t id,
-                                    ThreadSafeQueue<std::size_t>& queue) {
+  std::future<void>
+  asyncRunChecker(const std::size_t id, std::shared_ptr<CompletionQueue> queue,
+                  std::shared_ptr<const Configuration> config = nullptr) {
     static_assert(std::is_base_of_v<EquivalenceChecker, Checker>,
                   "Checker must be derived from EquivalenceChecker");
-    return std::async(std::launch::async, [this, id, &queue]() {
+    return threadPool->submit([this, id, queue = std::move(queue),
+                               config = std::move(config),
+                               token = stopSource.getToken(),
+                               lock = toleranceLock.lock()]() mutable {
+      // the lock is released as soon as the task finishes (rather than when
+      // its future is destroyed)
+      const auto heldLock = std::move(lock);
       try {
+        // the task might only be picked up after the check has concluded
+        if (token.stopRequested()) {
+          queue->push(id);
+          return;
+        }
+
         auto& checker = checkers[id];
         if (!checker) {
-          checker = std::make_unique<Checker>(qc1, qc2, configuration);
+          const auto& checkerConfig = config ? *config : configuration;
+          checker = std::make_unique<Checker>(qc1, qc2, checkerConfig);
+          // the checker runs on one of the pool's threads itself
+          checker->setThreadPool(threadPool,
+                                 Checker::parallelism(checkerConfig) - 1U);
+        }
+        checker->setStopToken(token);
+
+        if constexpr (std::is_same_v<Checker, DDAlternatingChecker> ||
+                      std::is_same_v<Checker, MiterSplittingChecker>) {
+          alternatingCheckers[id].store(checker.get(),
+                                        std::memory_order_release);
         }
 
         if constexpr (std::is_same_v<Checker, DDSimulationChecker>) {
@@ -248,19 +383,134 @@ protected:
           simChecker->setRandomInitialState(stateGenerator);
         }
 
-        if (!done) {
+        if constexpr (std::is_same_v<Checker, DDBatchSimulationChecker>) {
+          auto* const batchChecker =
+              dynamic_cast<DDBatchSimulationChecker*>(checker.get());
+          const std::lock_guard stateGeneratorLock(stateGeneratorMutex);
+          batchChecker->setRandomInitialStates(stateGenerator,
+                                               simulationRuns[id]);
+        }
+
+        if (taskHook) {
+          taskHook(id, token);
+        }
+        if (!token.stopRequested()) {
           checker->run();
         }
-        queue.push(id);
+        queue->push(id);
       } catch (const std::exception& e) {
-        queue.push(id);
+        queue->push(id);
         throw;
       }
     });
   }
 
+  /// \brief Run a persistent simulation worker asynchronously
+  ///
+  /// In contrast to asyncRunChecker, the worker keeps its DDSimulationChecker
+  /// (and, hence, its decision diagram package) alive and processes the
+  /// pre-drawn stimuli one after another until either all stimuli have been
+  /// claimed, a simulation does not confirm equivalence, or the check is done.
+  /// The number of simulations performed by the worker is recorded in
+  /// `simulationRuns`.
+  ///
+  /// \tparam Checker The type of the simulation checker (either
+  /// DDSimulationChecker or DDBatchSimulationChecker). Batch checkers claim
+  /// up to `batchSize` stimuli at once.
+  /// \param id The id in the checkers vector where the checker is stored.
+  /// \param queue The queue to which the worker shall push its id once it is
+  /// done.
+  /// \return A future that can be used to wait for the worker to finish.
+  template <class Checker>
+  std::future<void>
+  asyncRunSimulationWorker(const std::size_t id,
+                           std::shared_ptr<CompletionQueue> queue) {
+    constexpr bool batch = std::is_same_v<Checker, DDBatchSimulationChecker>;
+    static_assert(batch || std::is_same_v<Checker, DDSimulationChecker>,
+                  "Checker must be a simulation checker");
+    return threadPool->submit([this, id, queue = std::move(queue),
+                               token = stopSource.getToken(),
+                               lock = toleranceLock.lock()]() mutable {
+      const auto heldLock = std::move(lock);
+      try {
+        if (token.stopRequested()) {
+          queue->push(id);
+          return;
+        }
+
+        auto& checker = checkers[id];
+        if (!checker) {
+          checker = std::make_unique<Checker>(qc1, qc2, configuration);
+        }
+        checker->setStopToken(token);
+        auto* const simChecker = dynamic_cast<Checker*>(checker.get());
+
+        const auto step = batch ? configuration.simulation.batchSize : 1U;
+        while (!token.stopRequested() &&
+               !simulationAborted.load(std::memory_order_relaxed)) {
+          const auto first =
+              nextStimulus.fetch_add(step, std::memory_order_relaxed);
+          if (first >= stimuli.size()) {
+            break;
+          }
+          const auto last = std::min(first + step, stimuli.size());
+          if constexpr (batch) {
+            simChecker->setInitialStates(
+                std::vector<Stimulus>(stimuli.begin() + first,
+                                      stimuli.begin() + last));
+          } else {
+            simChecker->setInitialState(stimuli[first]);
+          }
+          const auto result = simChecker->run();
+          // aborted simulations are not counted
+          if (simChecker->aborted()) {
+            simulationAborted.store(true, std::memory_order_relaxed);
+            break;
+          }
+          simulationRuns[id] += last - first;
+          if (result == EquivalenceCriterion::NotEquivalent ||
+              result == EquivalenceCriterion::NoInformation) {
+            break;
+          }
+        }
+        queue->push(id);
+      } catch (const std::exception& e) {
+        queue->push(id);
+        throw;
+      }
+    });
+  }
+
+  /// Draw the stimuli for all simulations upfront
+  void drawStimuli();
+
+  /// \brief Decide whether to conduct further simulations (adaptive stimulus
+  /// count).
+  /// \details Called once all simulations up to the current limit have been
+  /// performed. The limit is doubled (up to the configured maximum) unless the
+  /// next round of simulations is not expected to finish within the timeout
+  /// or the most advanced of the running alternating checkers is expected to
+  /// conclude before. The decision is recorded in the results.
+  /// The duration of the next round is estimated from the simulation
+  /// throughput observed so far.
+  /// \param start The start of the check.
+  /// \return Whether the limit has been raised.
+  bool raiseSimulationLimit(std::chrono::steady_clock::time_point start);
+
+  /// The running alternating checker that has made the most progress (or
+  /// nullptr if no alternating checker is running)
+  [[nodiscard]] const EquivalenceChecker*
+  mostAdvancedAlternatingChecker() const;
+
+  /// Whether the checker is one of the simulation checkers
+  [[nodiscard]] static bool
+  isSimulationChecker(const EquivalenceChecker* checker);
+
+  /// Record the counterexample found by a simulation checker in the results
+  void setCounterexample(const EquivalenceChecker* checker);
+
   [[nodiscard]] bool simulationsFinished() const {
-    return results.performedSimulations == configuration.simulation.maxSims;
+    return results.performedSimulations >= simulationLimit;
   }
 };
 } // namespace ec
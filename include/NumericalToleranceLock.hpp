@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "dd/DDDefinitions.hpp"
+
+namespace ec {
+/**
+ * @brief Scoped lock on the numerical tolerance of the decision diagram
+ * package.
+ * @details The numerical tolerance used by the decision diagram package is a
+ * process-wide setting. Any number of checks that use the same tolerance may
+ * hold the lock (and run) concurrently. A check that requires a different
+ * tolerance waits until all current holders have released the lock and then
+ * sets the tolerance. Checks that wait for a different tolerance take
+ * precedence over newly arriving checks so that they are not starved.
+ */
+class NumericalToleranceLock {
+public:
+  /// Blocks until the given tolerance is (or can be) set
+  explicit NumericalToleranceLock(dd::fp tolerance);
+  ~NumericalToleranceLock();
+
+  NumericalToleranceLock(const NumericalToleranceLock&) = delete;
+  NumericalToleranceLock& operator=(const NumericalToleranceLock&) = delete;
+  NumericalToleranceLock(NumericalToleranceLock&&) = delete;
+  NumericalToleranceLock& operator=(NumericalToleranceLock&&) = delete;
+};
+} // namespace ec
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ec {
+class StopToken;
+
+namespace detail {
+// state shared by a StopSource and all tokens obtained from it
+struct StopState {
+  std::atomic<bool> requested{false};
+  // a stop requested via any of these tokens is a stop of this state as well
+  std::vector<StopToken> parents;
+
+  [[nodiscard]] bool stopRequested() const noexcept;
+};
+} // namespace detail
+
+/**
+ * @brief A token that can be queried whether a stop has been requested.
+ * @details This is a minimal counterpart of C++20's `std::stop_token`. Tokens
+ * share their state with the StopSource they have been obtained from and, in
+ * particular, remain valid after the source has been destroyed. A
+ * default-constructed token is never stopped.
+ */
+class StopToken {
+public:
+  StopToken() = default;
+
+  [[nodiscard]] bool stopRequested() const noexcept {
+    return state && state->stopRequested();
+  }
+
+  [[nodiscard]] bool stopPossible() const noexcept {
+    return static_cast<bool>(state);
+  }
+
+private:
+  friend class StopSource;
+  explicit StopToken(std::shared_ptr<const detail::StopState> s) noexcept
+      : state(std::move(s)) {}
+
+  std::shared_ptr<const detail::StopState> state;
+};
+
+inline bool detail::StopState::stopRequested() const noexcept {
+  return requested.load(std::memory_order_relaxed) ||
+         std::any_of(parents.begin(), parents.end(), [](const auto& parent) {
+           return parent.stopRequested();
+         });
+}
+
+/**
+ * @brief Issues stop requests to all tokens obtained from it.
+ * @details This is a minimal counterpart of C++20's `std::stop_source`. A stop
+ * can only be requested once; it cannot be revoked. Use a new source for a new
+ * computation.
+ */
+class StopSource {
+public:
+  StopSource() : state(std::make_shared<detail::StopState>()) {}
+
+  /// Create a source whose tokens are additionally stopped as soon as a stop
+  /// is requested via any of the given tokens (e.g., to stop auxiliary
+  /// computations together with the computation they have been started from)
+  explicit StopSource(std::vector<StopToken> parents) : StopSource() {
+    state->parents = std::move(parents);
+  }
+
+  /// Request a stop. Returns whether this call issued the request.
+  bool requestStop() noexcept {
+    return !state->requested.exchange(true, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] bool stopRequested() const noexcept {
+    return state->stopRequested();
+  }
+
+  [[nodiscard]] StopToken getToken() const noexcept { return StopToken(state); }
+
+private:
+  std::shared_ptr<detail::StopState> state;
+};
+} // namespace ec
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief A fixed-size pool of worker threads with work stealing.
+ * @details Every worker owns a task queue. Submitted tasks are distributed
+ * over the workers' queues in a round-robin fashion. Workers process the tasks
+ * of their own queue first and, once that runs dry, steal tasks from the other
+ * end of the remaining workers' queues. The pool is meant to be long-lived and
+ * can be shared between multiple EquivalenceCheckingManager instances so that
+ * threads are not created and joined for every single check.
+ */
+class ThreadPool {
+public:
+  explicit ThreadPool(std::size_t nthreads);
+  ThreadPool();
+
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+
+  /// Waits for all submitted tasks to finish and joins the worker threads.
+  ~ThreadPool();
+
+  /// \brief Submit a task for execution on one of the workers.
+  /// \details Exceptions thrown by the task are captured and rethrown when
+  /// calling `get()` on the returned future. In contrast to the futures
+  /// returned by `std::async`, the destructor of the returned future does not
+  /// block until the task has finished.
+  /// \param task The task to execute. Must be invocable without arguments.
+  /// \return A future that can be used to wait for the task to finish.
+  template <class Task> std::future<void> submit(Task&& task) {
+    static_assert(std::is_invocable_v<Task>,
+                  "Task must be invocable without arguments");
+    std::packaged_task<void()> packagedTask(std::forward<Task>(task));
+    auto future = packagedTask.get_future();
+    // the counter is raised first so that it never drops below zero when a
+    // worker picks up the task before the submitting thread gets to notify
+    {
+      const std::lock_guard sleepLock(sleepMutex);
+      ++pendingTasks;
+    }
+    const auto index =
+        nextQueue.fetch_add(1U, std::memory_order_relaxed) % queues.size();
+    {
+      const std::lock_guard queueLock(queues[index]->mutex);
+      queues[index]->tasks.emplace_back(std::move(packagedTask));
+    }
+    sleepCond.notify_one();
+    return future;
+  }
+
+  /// \brief Run `body(i)` for every `i` in `[0, n)`.
+  /// \details The calling thread takes part in the loop and at most `helpers`
+  /// tasks are submitted to the pool to help with it. Iterations are only
+  /// claimed by helpers once they have been picked up by a worker. Hence, the
+  /// calling thread never waits for helpers that are queued behind other
+  /// tasks and the function may safely be called from a task running on the
+  /// pool itself. Once an iteration throws, the remaining iterations are
+  /// skipped and the exception is rethrown after all running iterations have
+  /// finished.
+  /// \param helpers The maximum number of workers that help with the loop.
+  /// \param n The number of iterations.
+  /// \param body The body of the loop. Must be invocable with the index of
+  /// the iteration.
+  template <class Body>
+  void parallelFor(std::size_t helpers, const std::size_t n, Body&& body) {
+    if (n == 0U) {
+      return;
+    }
+    const auto loop = std::make_shared<Loop>(std::forward<Body>(body), n);
+    helpers = std::min({helpers, size(), n - 1U});
+    for (std::size_t i = 0U; i < helpers; ++i) {
+      submit([loop] {
+        {
+          const std::lock_guard loopLock(loop->mutex);
+          // the loop has already been finished by the other threads
+          if (loop->closed) {
+            return;
+          }
+          ++loop->helpers;
+        }
+        loop->work();
+        {
+          const std::lock_guard loopLock(loop->mutex);
+          --loop->helpers;
+        }
+        loop->cond.notify_all();
+      });
+    }
+    loop->work();
+
+    std::unique_lock loopLock(loop->mutex);
+    loop->closed = true;
+    loop->cond.wait(loopLock, [&loop] { return loop->helpers == 0U; });
+    if (loop->exception) {
+      std::rethrow_exception(loop->exception);
+    }
+  }
+
+  /// Returns the number of worker threads in the pool
+  [[nodiscard]] std::size_t size() const noexcept { return workers.size(); }
+
+private:
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<std::packaged_task<void()>> tasks;
+  };
+
+  // state of a parallel loop shared between the calling thread and helpers
+  struct Loop {
+    Loop(std::function<void(std::size_t)> b, const std::size_t iterations)
+        : body(std::move(b)), n(iterations) {}
+
+    std::function<void(std::size_t)> body;
+    std::size_t n;
+    std::atomic<std::size_t> next{0U};
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    // number of helpers currently working on the loop
+    std::size_t helpers{0U};
+    // set once the calling thread has run out of iterations
+    bool closed{false};
+    std::exception_ptr exception;
+
+    void work() {
+      for (auto i = next.fetch_add(1U); i < n; i = next.fetch_add(1U)) {
+        try {
+          body(i);
+        } catch (...) {
+          const std::lock_guard loopLock(mutex);
+          if (!exception) {
+            exception = std::current_exception();
+          }
+          next.store(n);
+        }
+      }
+    }
+  };
+
+  std::vector<std::unique_ptr<WorkQueue>> queues;
+  std::vector<std::thread> workers;
+  std::atomic<std::size_t> nextQueue{0U};
+
+  std::mutex sleepMutex;
+  std::condition_variable sleepCond;
+  std::size_t pendingTasks{0U};
+  bool stopping{false};
+
+  bool popLocal(std::size_t index, std::packaged_task<void()>& task);
+  bool steal(std::size_t index, std::packaged_task<void()>& task);
+  void workerLoop(std::size_t index);
+};
+} // namespace ec
@@ -12,12 +12,15 @@
 
 #include "Configuration.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "StopToken.hpp"
+#include "ThreadPool.hpp"
 #include "ir/QuantumComputation.hpp"
 
 #include <algorithm>
-#include <atomic>
 #include <cstddef>
+#include <memory>
 #include <nlohmann/json_fwd.hpp>
+#include <string>
 #include <utility>
 
 namespace ec {
@@ -39,11 +42,41 @@ public:
   }
   [[nodiscard]] double getRuntime() const noexcept { return runtime; }
 
+  /// Returns whether the checker gave up without reaching a conclusion, e.g.,
+  /// because it exceeded its memory budget
+  [[nodiscard]] bool aborted() const noexcept { return !abortReason.empty(); }
+  [[nodiscard]] const std::string& getAbortReason() const noexcept {
+    return abortReason;
+  }
+
   virtual void json(nlohmann::json& j) const noexcept;
 
-  void signalDone() { done.store(true, std::memory_order_relaxed); }
+  /// Returns the fraction of the check that has been completed so far (0 if
+  /// unknown). May be queried while the checker is running.
+  [[nodiscard]] virtual double getProgress() const noexcept { return 0.; }
+
+  void signalDone() { done.requestStop(); }
   [[nodiscard]] auto isDone() const {
-    return done.load(std::memory_order_relaxed);
+    return done.stopRequested() || stopToken.stopRequested();
+  }
+
+  /// Additionally stop the checker as soon as a stop is requested via the
+  /// given token (e.g., because another checker has determined the result)
+  void setStopToken(StopToken token) noexcept { stopToken = std::move(token); }
+
+  /// Returns the number of threads a checker with the given configuration can
+  /// put to use (including the thread it is run on)
+  [[nodiscard]] static std::size_t
+  parallelism(const Configuration& /*config*/) noexcept {
+    return 1U;
+  }
+
+  /// Let the checker run parts of its computation on at most `helpers` threads
+  /// of the given pool in addition to the thread it is run on
+  void setThreadPool(std::shared_ptr<ThreadPool> pool,
+                     const std::size_t helpers) noexcept {
+    threadPool = std::move(pool);
+    helperThreads = helpers;
   }
 
 protected:
@@ -57,8 +90,32 @@ protected:
   EquivalenceCriterion equivalence = EquivalenceCriterion::NoInformation;
   double runtime{};
 
+  std::string abortReason;
+
+  /// Returns a new stop source whose tokens are also stopped once the checker
+  /// is done (e.g., for stopping auxiliary checkers run by this checker)
+  [[nodiscard]] StopSource linkedStopSource() const {
+    return StopSource({done.getToken(), stopToken});
+  }
+
+  /// Run `body(i)` for every `i` in `[0, n)` on the thread the checker is run
+  /// on and the helper threads granted to the checker (if any)
+  template <class Body> void parallelFor(const std::size_t n, Body&& body) {
+    if (threadPool && helperThreads > 0U) {
+      threadPool->parallelFor(helperThreads, n, std::forward<Body>(body));
+      return;
+    }
+    for (std::size_t i = 0U; i < n; ++i) {
+      body(i);
+    }
+  }
+
 private:
-  std::atomic<bool> done{false};
+  StopSource done;
+  StopToken stopToken;
+
+  std::shared_ptr<ThreadPool> threadPool;
+  std::size_t helperThreads = 0U;
 };
 
 } // namespace ec
@@ -12,9 +12,11 @@
 
 #include "DDEquivalenceChecker.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "dd/Node.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <cstddef>
 #include <nlohmann/json_fwd.hpp>
 
 namespace qc {
@@ -32,6 +34,10 @@ public:
 
   void json(nlohmann::json& j) const noexcept override;
 
+  [[nodiscard]] ApplicationSchemeType getApplicationScheme() const noexcept {
+    return configuration.application.alternatingScheme;
+  }
+
   /// a function to determine whether the alternating checker can handle
   /// checking both circuits. In particular, it checks whether both circuits
   /// contain non-idle ancillaries.
@@ -41,6 +47,11 @@ public:
 private:
   dd::MatrixDD functionality{};
 
+  // number of gate pairs that have been cancelled structurally at the start
+  // and the end of the circuits before applying any gates
+  std::size_t cancelledPrefix = 0U;
+  std::size_t cancelledSuffix = 0U;
+
   void initialize() override;
   void execute() override;
   void finish() override;
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "DDEquivalenceChecker.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/dd/TaskManager.hpp"
+#include "dd/Node.hpp"
+
+#include <cstddef>
+#include <nlohmann/json_fwd.hpp>
+#include <vector>
+
+namespace qc {
+class QuantumComputation;
+}
+
+namespace ec {
+class Configuration;
+class StateGenerator;
+struct Stimulus;
+
+/**
+ * @brief Simulation checker that processes a batch of stimuli at once.
+ * @details All stimuli of a batch are carried through both circuits in
+ * lock-step. The decision diagram of each gate is only constructed once and is
+ * then applied to all states of the batch before moving on to the next gate.
+ * This amortizes gate construction and compute table lookups across the batch.
+ * Once both circuits have been simulated, the resulting states are compared
+ * pairwise. The batch is considered non-equivalent as soon as a single pair of
+ * output states differs.
+ */
+class DDBatchSimulationChecker final
+    : public DDEquivalenceChecker<dd::VectorDD> {
+public:
+  DDBatchSimulationChecker(const qc::QuantumComputation& circ1,
+                           const qc::QuantumComputation& circ2,
+                           Configuration config);
+
+  /// Draw `count` random stimuli and use them for the next run
+  void setRandomInitialStates(StateGenerator& generator, std::size_t count);
+
+  /// Build previously drawn stimuli in the checker's package and use them for
+  /// the next run
+  void setInitialStates(const std::vector<Stimulus>& stimuli);
+
+  EquivalenceCriterion run() override;
+
+  /// Returns the number of stimuli in the current batch
+  [[nodiscard]] std::size_t getBatchSize() const noexcept {
+    return initialStates.size();
+  }
+
+  /// Returns the initial state of the stimulus that showed non-equivalence
+  [[nodiscard]] auto getInitialState() const -> const auto& {
+    return initialState;
+  }
+  /// Returns the output state of the first circuit for the stimulus that
+  /// showed non-equivalence
+  [[nodiscard]] auto getInternalState1() const -> const auto& {
+    return internalState1;
+  }
+  /// Returns the output state of the second circuit for the stimulus that
+  /// showed non-equivalence
+  [[nodiscard]] auto getInternalState2() const -> const auto& {
+    return internalState2;
+  }
+
+  void json(nlohmann::basic_json<>& j) const noexcept override;
+
+private:
+  std::vector<dd::VectorDD> initialStates;
+
+  // counterexample in case the batch showed non-equivalence
+  dd::VectorDD initialState{};
+  dd::VectorDD internalState1{};
+  dd::VectorDD internalState2{};
+
+  void simulate(TaskManager<dd::VectorDD>& task,
+                std::vector<dd::VectorDD>& states);
+  void postprocessStates(TaskManager<dd::VectorDD>& task,
+                         std::vector<dd::VectorDD>& states);
+  void releaseStates(std::vector<dd::VectorDD>& states);
+};
+} // namespace ec
@@ -14,6 +14,7 @@
 #include "checker/dd/TaskManager.hpp"
 #include "dd/Node.hpp"
 
+#include <cstddef>
 #include <nlohmann/json_fwd.hpp>
 
 namespace qc {
@@ -31,7 +32,18 @@ public:
 
   void json(nlohmann::json& j) const noexcept override;
 
+  /// The segments of both circuits are constructed concurrently
+  [[nodiscard]] static std::size_t
+  parallelism(const Configuration& config) noexcept;
+
 private:
   void initializeTask(TaskManager<dd::MatrixDD>& taskManager) override;
+
+  /// Constructs the functionalities of both circuits gate by gate according
+  /// to the application scheme or, if more than one construction segment is
+  /// configured, by constructing the functionalities of contiguous segments
+  /// of the circuits concurrently (on the helper threads granted to the
+  /// checker) and combining them afterwards.
+  void execute() override;
 };
 } // namespace ec
@@ -11,7 +11,10 @@
 #pragma once
 
 #include "Configuration.hpp"
+#include "DDPackageConfigs.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "GarbageCollector.hpp"
+#include "GateCache.hpp"
 #include "TaskManager.hpp"
 #include "applicationscheme/ApplicationScheme.hpp"
 #include "checker/EquivalenceChecker.hpp"
@@ -19,9 +22,11 @@
 #include "dd/Package.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <nlohmann/json_fwd.hpp>
+#include <type_traits>
 #include <utility>
 
 namespace ec {
@@ -30,28 +35,88 @@ public:
   DDEquivalenceChecker(
       const qc::QuantumComputation& circ1, const qc::QuantumComputation& circ2,
       Configuration config,
-      const dd::DDPackageConfig& packageConfig = dd::DDPackageConfig{})
+      const dd::DDPackageConfig& defaultPackageConfig = dd::DDPackageConfig{})
       : EquivalenceChecker(circ1, circ2, std::move(config)),
+        packageConfig(adaptPackageConfig(
+            defaultPackageConfig, std::is_same_v<DDType, dd::MatrixDD>, nqubits,
+            circ1.size() + circ2.size(), configuration.execution)),
         dd(std::make_unique<dd::Package>(nqubits, packageConfig)),
         taskManager1(TaskManager<DDType>(circ1, *dd)),
-        taskManager2(TaskManager<DDType>(circ2, *dd)) {}
+        taskManager2(TaskManager<DDType>(circ2, *dd)) {
+    if (configuration.execution.gateCacheSize > 0U) {
+      gateCache = std::make_unique<GateCache>(
+          *dd, configuration.execution.gateCacheSize);
+      taskManager1.setGateCache(gateCache.get());
+      taskManager2.setGateCache(gateCache.get());
+    }
+    if (const auto& exe = configuration.execution;
+        exe.gcPolicy != GarbageCollectionPolicy::Always) {
+      garbageCollector = std::make_unique<GarbageCollector>(
+          *dd, exe.gcPolicy, exe.gcInterval, exe.gcLoadFactor,
+          exe.gcHighWaterMark, packageConfig);
+      taskManager1.setGarbageCollector(garbageCollector.get());
+      taskManager2.setGarbageCollector(garbageCollector.get());
+    }
+    // react to cancellations within multi-gate steps of the application scheme
+    taskManager1.setCancellationHook([this] { return isDone(); });
+    taskManager2.setCancellationHook([this] { return isDone(); });
+  }
 
   EquivalenceCriterion run() override;
 
   void json(nlohmann::json& j) const noexcept override;
 
+  /// Returns the fraction of the gates of both circuits that have been applied
+  /// so far. May be queried while the checker is running.
+  [[nodiscard]] double getProgress() const noexcept override {
+    const auto total = qc1->size() + qc2->size();
+    if (total == 0U) {
+      return 1.;
+    }
+    return static_cast<double>(appliedGates.load(std::memory_order_relaxed)) /
+           static_cast<double>(total);
+  }
+
+  /// Returns the number of active nodes in the package as of the last
+  /// recorded step. May be queried while the checker is running.
+  [[nodiscard]] std::size_t getActiveNodes() const noexcept {
+    return activeNodes.load(std::memory_order_relaxed);
+  }
+
 protected:
+  // the configuration the package has been created with (after adapting its
+  // table sizes to the circuits)
+  dd::DDPackageConfig packageConfig;
   std::unique_ptr<dd::Package> dd;
 
   TaskManager<DDType> taskManager1;
   TaskManager<DDType> taskManager2;
 
+  // shared by both task managers; declared after the package so that it is
+  // destroyed (and its entries are released) first
+  std::unique_ptr<GateCache> gateCache;
+
+  // shared by both task managers (not set for the default policy)
+  std::unique_ptr<GarbageCollector> garbageCollector;
+
   std::unique_ptr<ApplicationScheme<DDType>> applicationScheme;
 
   std::size_t maxActiveNodes{};
 
+  // progress of a running check (see getProgress and getActiveNodes)
+  std::atomic<std::size_t> appliedGates{0U};
+  std::atomic<std::size_t> activeNodes{0U};
+
   void initializeApplicationScheme(ApplicationSchemeType scheme);
 
+  /// Abort the check (by signalling that it is done) if the nodes of the
+  /// package occupy more memory than the configured budget, even after
+  /// collecting garbage.
+  void checkMemoryBudget();
+
+  /// Record the number of applied gates and active nodes after a step
+  void recordProgress();
+
   // at some point this routine should probably make its way into the DD package
   // in some form
   EquivalenceCriterion equals(const DDType& e, const DDType& f);
@@ -10,68 +10,98 @@
 
 #pragma once
 
+#include "Configuration.hpp"
 #include "dd/DDpackageConfig.hpp"
 
 #include <cstddef>
 
 namespace ec {
 struct SimulationDDPackageConfig : public dd::DDPackageConfig {
-  // simulation requires more resources for vectors.
-  static constexpr std::size_t UT_VEC_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_VEC_ADD_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_VEC_MULT_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_VEC_INNER_PROD_NBUCKET = 32'768U;
+  SimulationDDPackageConfig() {
+    // simulation requires more resources for vectors.
+    utVecNumBucket = 65'536U;
+    ctVecAddNumBucket = 65'536U;
+    ctMatVecMultNumBucket = 65'536U;
+    ctVecInnerProdNumBucket = 32'768U;
 
-  // simulation only needs matrices for representing operations. Hence, very
-  // little is needed here.
-  static constexpr std::size_t UT_MAT_NBUCKET = 128U;
-  static constexpr std::size_t UT_MAT_INITIAL_ALLOCATION_SIZE = 32U;
+    // simulation only needs matrices for representing operations. Hence, very
+    // little is needed here.
+    utMatNumBucket = 128U;
+    utMatInitialAllocationSize = 32U;
 
-  // simulation needs no matrix addition, conjugate transposition, matrix-matrix
-  // multiplication, or kronecker products.
-  static constexpr std::size_t CT_MAT_ADD_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_CONJ_TRANS_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_MAT_MULT_NBUCKET = 1U;
-  static constexpr std::size_t CT_VEC_KRON_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_KRON_NBUCKET = 1U;
+    // simulation needs no matrix addition, conjugate transposition,
+    // matrix-matrix multiplication, or kronecker products.
+    ctMatAddNumBucket = 1U;
+    ctMatConjTransNumBucket = 1U;
+    ctMatMatMultNumBucket = 1U;
+    ctVecKronNumBucket = 1U;
+    ctMatKronNumBucket = 1U;
+  }
 };
 
 struct ConstructionDDPackageConfig : public dd::DDPackageConfig {
-  // construction requires more resources for matrices.
-  static constexpr std::size_t UT_MAT_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_ADD_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_MAT_MULT_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_CONJ_TRANS_NBUCKET = 32'768U;
+  ConstructionDDPackageConfig() {
+    // construction requires more resources for matrices.
+    utMatNumBucket = 65'536U;
+    ctMatAddNumBucket = 65'536U;
+    ctMatMatMultNumBucket = 65'536U;
+    ctMatConjTransNumBucket = 32'768U;
 
-  // construction does not need any vector nodes
-  static constexpr std::size_t UT_VEC_NBUCKET = 1U;
-  static constexpr std::size_t UT_VEC_INITIAL_ALLOCATION_SIZE = 1U;
+    // construction does not need any vector nodes
+    utVecNumBucket = 1U;
+    utVecInitialAllocationSize = 1U;
 
-  // construction needs no vector addition, matrix-vector multiplication,
-  // kronecker products, or inner products.
-  static constexpr std::size_t CT_VEC_ADD_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_VEC_MULT_NBUCKET = 1U;
-  static constexpr std::size_t CT_VEC_KRON_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_KRON_NBUCKET = 1U;
-  static constexpr std::size_t CT_VEC_INNER_PROD_NBUCKET = 1U;
+    // construction needs no vector addition, matrix-vector multiplication,
+    // kronecker products, or inner products.
+    ctVecAddNumBucket = 1U;
+    ctMatVecMultNumBucket = 1U;
+    ctVecKronNumBucket = 1U;
+    ctMatKronNumBucket = 1U;
+    ctVecInnerProdNumBucket = 1U;
+  }
 };
 
 struct AlternatingDDPackageConfig : public dd::DDPackageConfig {
-  // The alternating checker requires more resources for matrices.
-  static constexpr std::size_t UT_MAT_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_ADD_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_MAT_MULT_NBUCKET = 65'536U;
+  AlternatingDDPackageConfig() {
+    // The alternating checker requires more resources for matrices.
+    utMatNumBucket = 65'536U;
+    ctMatAddNumBucket = 65'536U;
+    ctMatMatMultNumBucket = 65'536U;
 
-  // The alternating checker does not need any vector nodes
-  static constexpr std::size_t UT_VEC_NBUCKET = 1U;
-  static constexpr std::size_t UT_VEC_INITIAL_ALLOCATION_SIZE = 1U;
+    // The alternating checker does not need any vector nodes
+    utVecNumBucket = 1U;
+    utVecInitialAllocationSize = 1U;
 
-  // The alternating needs no vector addition, matrix-vector multiplication,
-  // kronecker products, or inner products.
-  static constexpr std::size_t CT_VEC_ADD_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_VEC_MULT_NBUCKET = 1U;
-  static constexpr std::size_t CT_VEC_KRON_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_KRON_NBUCKET = 1U;
-  static constexpr std::size_t CT_VEC_INNER_PROD_NBUCKET = 1U;
+    // The alternating needs no vector addition, matrix-vector multiplication,
+    // kronecker products, or inner products.
+    ctVecAddNumBucket = 1U;
+    ctMatVecMultNumBucket = 1U;
+    ctVecKronNumBucket = 1U;
+    ctMatKronNumBucket = 1U;
+    ctVecInnerProdNumBucket = 1U;
+  }
 };
+
+/**
+ * @brief Adapt the table sizes of a package configuration to the problem size.
+ * @details The configurations above are tuned for medium-sized instances and
+ * are only used if adaptive table sizing is enabled. In that case, the tables
+ * for the primary kind of decision diagram (matrices or vectors) are scaled by
+ * a power of two such that the primary unique table has roughly as many
+ * buckets as nodes are expected for circuits of the given size. Tables that
+ * are disabled (i.e., have a single bucket) are left untouched. Otherwise, the
+ * default configuration of the package is used. Explicit bucket counts from
+ * the execution options take precedence in both cases.
+ * @param config The configuration tuned for the checker.
+ * @param matrices Whether the checker primarily works with matrices (as
+ * opposed to vectors).
+ * @param nqubits The number of qubits of the package.
+ * @param ngates The total number of gates in both circuits.
+ * @param execution The execution options holding the sizing policy.
+ * @return The adapted configuration.
+ */
+[[nodiscard]] dd::DDPackageConfig
+adaptPackageConfig(const dd::DDPackageConfig& config, bool matrices,
+                   std::size_t nqubits, std::size_t ngates,
+                   const Configuration::Execution& execution);
 } // namespace ec
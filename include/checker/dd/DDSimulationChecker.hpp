@@ -24,6 +24,7 @@ class QuantumComputation;
 namespace ec {
 class Configuration;
 class StateGenerator;
+struct Stimulus;
 
 class DDSimulationChecker final : public DDEquivalenceChecker<dd::VectorDD> {
 public:
@@ -33,6 +34,10 @@ public:
 
   void setRandomInitialState(StateGenerator& generator);
 
+  /// Build a previously drawn stimulus in the checker's package and use it as
+  /// the initial state for the next simulation run
+  void setInitialState(const Stimulus& stimulus);
+
   /// Returns the initial state used for simulation
   [[nodiscard]] auto getInitialState() const -> const auto& {
     return initialState;
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace ec {
+// Policies that determine when the decision diagram package is asked to
+// collect garbage during the application of gates
+enum class GarbageCollectionPolicy : std::uint8_t {
+  // after every gate (the package itself decides whether collection pays off)
+  Always = 0,
+  // after every `gcInterval` gates
+  Periodic = 1,
+  // whenever the unique tables hold more than `gcLoadFactor` entries per bucket
+  LoadFactor = 2,
+  // whenever the estimated memory of the unique tables exceeds
+  // `gcHighWaterMark` MiB
+  HighWaterMark = 3,
+  // adapt the collection interval based on the yield of the last collection
+  Adaptive = 4
+};
+
+inline std::string toString(const GarbageCollectionPolicy& policy) noexcept {
+  switch (policy) {
+  case GarbageCollectionPolicy::Periodic:
+    return "periodic";
+  case GarbageCollectionPolicy::LoadFactor:
+    return "load_factor";
+  case GarbageCollectionPolicy::HighWaterMark:
+    return "high_water_mark";
+  case GarbageCollectionPolicy::Adaptive:
+    return "adaptive";
+  default:
+    return "always";
+  }
+}
+
+inline GarbageCollectionPolicy
+garbageCollectionPolicyFromString(const std::string& policy) noexcept {
+  if ((policy == "always") || (policy == "0")) {
+    return GarbageCollectionPolicy::Always;
+  }
+  if ((policy == "periodic") || (policy == "1")) {
+    return GarbageCollectionPolicy::Periodic;
+  }
+  if ((policy == "load_factor") || (policy == "2")) {
+    return GarbageCollectionPolicy::LoadFactor;
+  }
+  if ((policy == "high_water_mark") || (policy == "3")) {
+    return GarbageCollectionPolicy::HighWaterMark;
+  }
+  if ((policy == "adaptive") || (policy == "4")) {
+    return GarbageCollectionPolicy::Adaptive;
+  }
+  std::cerr << "Unknown garbage collection policy: " << policy
+            << ". Defaulting to always!\n";
+  return GarbageCollectionPolicy::Always;
+}
+
+inline std::istream& operator>>(std::istream& in,
+                                GarbageCollectionPolicy& policy) {
+  std::string token;
+  in >> token;
+
+  if (token.empty()) {
+    in.setstate(std::istream::failbit);
+    return in;
+  }
+
+  policy = garbageCollectionPolicyFromString(token);
+  return in;
+}
+
+inline std::ostream& operator<<(std::ostream& out,
+                                const GarbageCollectionPolicy& policy) {
+  out << toString(policy);
+  return out;
+}
+} // namespace ec
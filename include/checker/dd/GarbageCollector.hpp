@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "checker/dd/GarbageCollectionPolicy.hpp"
+#include "dd/DDpackageConfig.hpp"
+#include "dd/Package_fwd.hpp"
+
+#include <cstddef>
+#include <nlohmann/json_fwd.hpp>
+
+namespace ec {
+/**
+ * @brief Decides when to collect garbage in a decision diagram package.
+ * @details The collector is invoked after every gate application and asks the
+ * package to collect garbage according to the configured
+ * GarbageCollectionPolicy. This allows trading off throughput (fewer
+ * collections) versus peak memory (more collections).
+ */
+class GarbageCollector {
+public:
+  /// \param dd The package to collect garbage in.
+  /// \param gcPolicy The policy to follow.
+  /// \param gcInterval The number of gates in between two collections
+  /// (periodic policy).
+  /// \param loadFactor The maximum number of unique table entries per bucket
+  /// (load factor policy).
+  /// \param highWaterMark The maximum memory of the package in MiB (high water
+  /// mark policy, see estimateMemory).
+  /// \param packageConfig The configuration the package has been created with.
+  GarbageCollector(dd::Package& dd, GarbageCollectionPolicy gcPolicy,
+                   std::size_t gcInterval, double loadFactor,
+                   std::size_t highWaterMark,
+                   const dd::DDPackageConfig& packageConfig);
+
+  /// Notify the collector that a gate has been applied
+  void operator()();
+
+  [[nodiscard]] GarbageCollectionPolicy getPolicy() const noexcept {
+    return policy;
+  }
+  /// Returns how often the package has been asked to collect garbage
+  [[nodiscard]] std::size_t getInvocations() const noexcept {
+    return invocations;
+  }
+  /// Returns how often the package actually collected garbage
+  [[nodiscard]] std::size_t getCollections() const noexcept {
+    return collections;
+  }
+
+  void json(nlohmann::json& j) const;
+
+  /// Returns the number of nodes in the package's unique tables
+  [[nodiscard]] static std::size_t numEntries(const dd::Package& dd);
+
+  /// Returns an estimate of the memory (in bytes) occupied by the nodes in the
+  /// package's unique tables
+  [[nodiscard]] static std::size_t nodeMemory(const dd::Package& dd);
+
+  /// Returns an estimate of the memory (in bytes) occupied by the compute
+  /// tables of a package with the given configuration. The tables are
+  /// allocated in full when the package is created.
+  [[nodiscard]] static std::size_t
+  computeTableMemory(const dd::DDPackageConfig& config);
+
+  /// Returns an estimate of the memory (in bytes) occupied by the package,
+  /// i.e., by its nodes and its compute tables
+  [[nodiscard]] static std::size_t
+  estimateMemory(const dd::Package& dd, const dd::DDPackageConfig& config) {
+    return nodeMemory(dd) + computeTableMemory(config);
+  }
+
+private:
+  dd::Package* package;
+  GarbageCollectionPolicy policy;
+
+  // number of gates in between two collections (periodic and adaptive policy)
+  std::size_t interval;
+  // maximum number of unique table entries (load factor policy)
+  std::size_t maxEntries;
+  // maximum memory in bytes (high water mark policy)
+  std::size_t maxMemory;
+  // memory occupied by the compute tables of the package in bytes
+  std::size_t computeTables;
+
+  std::size_t gatesSinceCollection = 0U;
+  // number of nodes (or bytes occupied by nodes) that survived the last forced
+  // collection. A new forced collection is only triggered once this amount has
+  // doubled, which prevents collecting on every gate if most nodes are alive.
+  std::size_t survivorsEntries = 0U;
+  std::size_t survivorsMemory = 0U;
+
+  std::size_t invocations = 0U;
+  std::size_t collections = 0U;
+
+  static constexpr std::size_t ADAPTIVE_MAX_INTERVAL = 1024U;
+  static constexpr double ADAPTIVE_LOW_YIELD = 0.1;
+  static constexpr double ADAPTIVE_HIGH_YIELD = 0.5;
+
+  bool collect(bool force);
+};
+} // namespace ec
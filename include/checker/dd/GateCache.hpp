@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "dd/Node.hpp"
+#include "dd/Package_fwd.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/Permutation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <cstddef>
+#include <list>
+#include <nlohmann/json_fwd.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief A bounded cache for the decision diagrams of individual gates.
+ * @details Compiled circuits frequently contain the very same gate (same type,
+ * parameters, targets, and controls after applying the current permutation)
+ * thousands of times. Instead of reconstructing the corresponding decision
+ * diagram for every occurrence, the cache keeps the most recently used gate
+ * DDs of a package alive. Cached DDs are pinned via their reference count so
+ * that they survive garbage collection. Once the capacity is reached, the least
+ * recently used entry is evicted (and unpinned).
+ *
+ * A cache is tied to a single package and must not outlive it.
+ */
+class GateCache {
+public:
+  GateCache(dd::Package& dd, std::size_t maxEntries);
+  ~GateCache();
+
+  GateCache(const GateCache&) = delete;
+  GateCache& operator=(const GateCache&) = delete;
+
+  /// \brief Get the decision diagram of an operation.
+  /// \details Only standard operations are cached. For all other operations,
+  /// the decision diagram is constructed directly.
+  /// \param op The operation.
+  /// \param permutation The permutation to apply to the operation's qubits.
+  /// Uncontrolled SWAP operations are never cached as they only update the
+  /// permutation.
+  /// \param inverse Whether to get the decision diagram of the inverse
+  /// operation.
+  /// \return The decision diagram of the (inverse) operation.
+  [[nodiscard]] dd::MatrixDD get(const qc::Operation& op,
+                                 qc::Permutation& permutation, bool inverse);
+
+  /// Unpin and remove all cached decision diagrams
+  void clear();
+
+  [[nodiscard]] std::size_t size() const noexcept { return entries.size(); }
+  [[nodiscard]] std::size_t getCapacity() const noexcept { return capacity; }
+  [[nodiscard]] std::size_t getHits() const noexcept { return hits; }
+  [[nodiscard]] std::size_t getMisses() const noexcept { return misses; }
+  [[nodiscard]] std::size_t getEvictions() const noexcept { return evictions; }
+
+  void json(nlohmann::json& j) const;
+
+private:
+  struct Key {
+    qc::OpType type{};
+    bool inverse{};
+    std::vector<qc::fp> parameters;
+    qc::Targets targets;
+    qc::Controls controls;
+
+    bool operator==(const Key& other) const {
+      return type == other.type && inverse == other.inverse &&
+             parameters == other.parameters && targets == other.targets &&
+             controls == other.controls;
+    }
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const noexcept;
+  };
+
+  using Entry = std::pair<Key, dd::MatrixDD>;
+
+  dd::Package* package;
+  std::size_t capacity;
+
+  // entries in order of their last use (most recently used first)
+  std::list<Entry> entries;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> lookup;
+
+  std::size_t hits = 0U;
+  std::size_t misses = 0U;
+  std::size_t evictions = 0U;
+};
+} // namespace ec
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace ec {
+/// The gates of two circuits that cancel each other structurally
+struct CancelledGates {
+  // whether an operation of the respective circuit has been cancelled
+  std::vector<bool> first;
+  std::vector<bool> second;
+  // number of cancelled pairs at the start and the end of the circuits
+  std::size_t prefix = 0U;
+  std::size_t suffix = 0U;
+};
+
+/**
+ * @brief Find identical gates at the start and the end of two circuits that
+ * cancel each other in U_1 U_2^-1.
+ * @details Every circuit is viewed as a dependency graph in which a gate
+ * depends on all preceding gates that act on at least one of its qubits.
+ * Gates on the frontier of both graphs (i.e., without remaining predecessors)
+ * that are identical (with respect to the initial layouts) cancel each other
+ * and are removed, which may expose further gates. Only the first `window`
+ * remaining operations of each circuit are considered at any time. Afterwards,
+ * the same is done from the end of the circuits (with respect to the
+ * permutations at the end of the circuits), if `suffix` is set.
+ *
+ * SWAP operations (which are elided while applying gates), non-unitary
+ * operations, barriers, and operations acting on one of the `blocked`
+ * (logical) qubits are never cancelled and block all later (or earlier)
+ * operations on their qubits.
+ */
+CancelledGates cancelGates(const qc::QuantumComputation& qc1,
+                           const qc::QuantumComputation& qc2,
+                           std::size_t window, const std::vector<bool>& blocked,
+                           bool suffix);
+} // namespace ec
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/EquivalenceChecker.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <nlohmann/json_fwd.hpp>
+#include <utility>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief Splits the alternating check into independent sub-miters.
+ * @details Both circuits are aligned operation by operation. Whenever the
+ * operations differ, a region is opened that extends up to the next
+ * synchronization point, i.e., the next run of `SYNC_LENGTH` identical
+ * operations in both circuits. If the circuits are written as
+ * U_1 = R_k D_k ... R_1 D_1 and U_2 = R_k E_k ... R_1 E_1 with identical parts
+ * R_i, the circuits are equivalent if every pair of regions D_i and E_i is.
+ * The regions are checked concurrently (on the helper threads granted to the
+ * checker) by separate DDAlternatingChecker instances. Since the converse does
+ * not hold, the whole circuits are checked by a single alternating checker as
+ * soon as any region is not shown to be equivalent.
+ *
+ * Operations are compared literally. Hence, the circuits should be in a
+ * canonical order (see the `reorderOperations` optimization), so that
+ * identical parts of their dependency graphs also appear as identical runs of
+ * operations.
+ */
+class MiterSplittingChecker final : public EquivalenceChecker {
+public:
+  /// A region of operations (given as half-open ranges of operation indices)
+  /// in which the two circuits differ
+  struct Region {
+    std::size_t begin1;
+    std::size_t end1;
+    std::size_t begin2;
+    std::size_t end2;
+  };
+
+  MiterSplittingChecker(const qc::QuantumComputation& circ1,
+                        const qc::QuantumComputation& circ2,
+                        Configuration config) noexcept
+      : EquivalenceChecker(circ1, circ2, std::move(config)) {}
+
+  EquivalenceCriterion run() override;
+
+  void json(nlohmann::json& j) const noexcept override;
+
+  /// Returns the fraction of the operations of both circuits that lie outside
+  /// of the regions in which they differ or in sub-miters that have been shown
+  /// to be equivalent. The fallback to an alternating check of the whole
+  /// circuits does not report any progress.
+  [[nodiscard]] double getProgress() const noexcept override;
+
+  /// The sub-miters are checked concurrently
+  [[nodiscard]] static std::size_t
+  parallelism(const Configuration& config) noexcept;
+
+  /// Returns whether the equivalence of the circuits (under the given
+  /// configuration) follows from the equivalence of their regions
+  static bool canSplit(const qc::QuantumComputation& qc1,
+                       const qc::QuantumComputation& qc2,
+                       const Configuration& config);
+
+  /// Returns the regions in which both circuits differ
+  static std::vector<Region> split(const qc::QuantumComputation& qc1,
+                                   const qc::QuantumComputation& qc2);
+
+  // number of consecutive identical operations that synchronize both circuits
+  static constexpr std::size_t SYNC_LENGTH = 4U;
+  // maximum number of operations (of both circuits together) that are skipped
+  // when searching for the next synchronization point
+  static constexpr std::size_t SYNC_DISTANCE = 256U;
+
+private:
+  std::size_t subMiters = 0U;
+  std::size_t checkedSubMiters = 0U;
+  std::size_t maxSubMiterSize = 0U;
+  bool fallback = false;
+  // operations accounted for in the progress (see getProgress)
+  std::atomic<std::size_t> resolvedOperations{0U};
+
+  EquivalenceCriterion checkSubMiters(const std::vector<Region>& regions);
+  EquivalenceCriterion checkWhole();
+};
+} // namespace ec
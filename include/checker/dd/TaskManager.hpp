@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "checker/dd/GarbageCollector.hpp"
+#include "checker/dd/GateCache.hpp"
 #include "dd/DDpackageConfig.hpp"
 #include "dd/Node.hpp"
 #include "dd/Operations.hpp"
@@ -20,8 +22,11 @@
 
 #include <cassert>
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace ec {
 enum class Direction : bool { Left = true, Right = false };
@@ -39,6 +44,7 @@ public:
   void reset() noexcept {
     iterator = qc->begin();
     permutation = qc->initialLayout;
+    skipMarked();
   }
 
   [[nodiscard]] bool finished() const noexcept { return iterator == end; }
@@ -57,10 +63,47 @@ public:
     }
   }
 
+  /// Skip over the operations marked in the given mask (indexed by the
+  /// position of the operations in the circuit) whenever advancing, e.g.,
+  /// because they cancel with operations of another circuit. Skipped
+  /// operations are not counted when advancing by a number of operations.
+  void setSkippedOperations(std::vector<bool> mask) {
+    skipped = std::move(mask);
+    skipMarked();
+  }
+
+  /// Use the given cache for constructing gate DDs (`nullptr` disables
+  /// caching). The cache must belong to the same package as the task manager.
+  void setGateCache(GateCache* cache) noexcept { gateCache = cache; }
+
+  /// Use the given collector for deciding when to collect garbage after a gate
+  /// has been applied (`nullptr` collects after every gate). The collector
+  /// must belong to the same package as the task manager.
+  void setGarbageCollector(GarbageCollector* collector) noexcept {
+    garbageCollector = collector;
+  }
+
+  /// Query the given hook in between individual decision diagram operations
+  /// and stop applying gates as soon as it returns `true`. This allows a
+  /// checker to react to a cancellation within a single step of an
+  /// application scheme that spans many gates (or a whole batch of states).
+  void setCancellationHook(std::function<bool()> hook) {
+    cancelled = std::move(hook);
+  }
+  [[nodiscard]] bool cancellationRequested() const {
+    return cancelled && cancelled();
+  }
+
   [[nodiscard]] dd::MatrixDD getDD() {
+    if (gateCache != nullptr) {
+      return gateCache->get(**iterator, permutation, false);
+    }
     return dd::getDD(**iterator, *package, permutation);
   }
   [[nodiscard]] dd::MatrixDD getInverseDD() {
+    if (gateCache != nullptr) {
+      return gateCache->get(**iterator, permutation, true);
+    }
     return dd::getInverseDD(**iterator, *package, permutation);
   }
 
@@ -72,7 +115,7 @@ public:
     return iterator;
   }
 
-  void advanceIterator() { ++iterator; }
+  void advanceIterator() { next(); }
 
   void applyGate(DDType& to) {
     auto saved = to;
@@ -88,24 +131,75 @@ public:
     }
     package->incRef(to);
     package->decRef(saved);
-    package->garbageCollect();
-    ++iterator;
+    collectGarbage();
+    next();
+  }
+
+  /// Apply the current gate to a whole batch of DDs. The gate DD is only
+  /// constructed once and garbage collection only happens after the gate has
+  /// been applied to all elements of the batch.
+  void applyGate(std::vector<DDType>& batch) {
+    const bool fromLeft =
+        std::is_same_v<DDType, dd::VectorDD> || direction == Direction::Left;
+    const auto gate = fromLeft ? getDD() : getInverseDD();
+    for (auto& to : batch) {
+      if (cancellationRequested()) {
+        // the remaining states are meaningless anyway
+        break;
+      }
+      auto saved = to;
+      if constexpr (std::is_same_v<DDType, dd::VectorDD>) {
+        // direction has no effect on state vector DDs
+        to = package->multiply(gate, to);
+      } else {
+        if (fromLeft) {
+          to = package->multiply(gate, to);
+        } else {
+          to = package->multiply(to, gate);
+        }
+      }
+      package->incRef(to);
+      package->decRef(saved);
+    }
+    collectGarbage();
+    next();
   }
 
   void applySwapOperations() {
-    while (!finished() && (*iterator)->getType() == qc::SWAP &&
-           !(*iterator)->isControlled()) {
-      const auto& targets = (*iterator)->getTargets();
-      assert(targets.size() == 2);
-      const auto t1 = targets[0];
-      const auto t2 = targets[1];
-      std::swap(permutation.at(t1), permutation.at(t2));
-      ++iterator;
+    while (!finished() && isElidedSwap()) {
+      elideSwap();
+    }
+  }
+
+  /// Skip over the given number of operations without applying them. Only the
+  /// permutation induced by SWAP operations is tracked. This allows to start
+  /// applying gates in the middle of a circuit.
+  void skip(const std::size_t ops) {
+    for (std::size_t i = 0U; i < ops && !finished(); ++i) {
+      if (isElidedSwap()) {
+        elideSwap();
+      } else {
+        next();
+      }
+    }
+  }
+
+  /// Apply the given number of operations (including SWAP operations, which
+  /// only change the permutation) to the state
+  void applyOperations(DDType& state, const std::size_t ops) {
+    for (std::size_t i = 0U;
+         i < ops && !finished() && !cancellationRequested(); ++i) {
+      if (isElidedSwap()) {
+        elideSwap();
+      } else {
+        applyGate(state);
+      }
     }
   }
 
   void advance(DDType& state, const std::size_t steps) {
-    for (std::size_t i = 0U; i < steps && !finished(); ++i) {
+    for (std::size_t i = 0U;
+         i < steps && !finished() && !cancellationRequested(); ++i) {
       applyGate(state);
       applySwapOperations();
     }
@@ -156,8 +250,48 @@ public:
   void decRef() { decRef(internalState); }
 
 private:
+  [[nodiscard]] bool isElidedSwap() const {
+    return (*iterator)->getType() == qc::SWAP && !(*iterator)->isControlled();
+  }
+
+  void next() noexcept {
+    ++iterator;
+    skipMarked();
+  }
+
+  void skipMarked() noexcept {
+    while (!finished()) {
+      const auto idx = static_cast<std::size_t>(iterator - qc->begin());
+      if (idx >= skipped.size() || !skipped[idx]) {
+        break;
+      }
+      ++iterator;
+    }
+  }
+
+  void elideSwap() {
+    const auto& targets = (*iterator)->getTargets();
+    assert(targets.size() == 2);
+    const auto t1 = targets[0];
+    const auto t2 = targets[1];
+    std::swap(permutation.at(t1), permutation.at(t2));
+    next();
+  }
+
+  void collectGarbage() {
+    if (garbageCollector != nullptr) {
+      (*garbageCollector)();
+    } else {
+      package->garbageCollect();
+    }
+  }
+
   const qc::QuantumComputation* qc{};
   dd::Package* package;
+  GateCache* gateCache{};
+  GarbageCollector* garbageCollector{};
+  std::function<bool()> cancelled;
+  std::vector<bool> skipped;
   Direction direction = Direction::Left;
   qc::Permutation permutation{};
   decltype(qc->begin()) iterator;
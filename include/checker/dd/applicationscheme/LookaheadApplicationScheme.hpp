@@ -11,38 +11,115 @@
 #pragma once
 
 #include "ApplicationScheme.hpp"
+#include "checker/dd/GarbageCollector.hpp"
 #include "checker/dd/TaskManager.hpp"
 #include "dd/Node.hpp"
 #include "dd/Package.hpp"
 
 #include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
 #include <utility>
+#include <vector>
 
 namespace ec {
+/**
+ * @brief Applies the operation of either circuit that keeps the decision
+ * diagram smallest.
+ * @details Applying `a` operations of the first circuit (from the left) and
+ * `b` operations of the second circuit (from the right) yields the same state
+ * regardless of the order of application. Hence, the states reachable within
+ * the next `depth` operations form a lattice of positions (a, b). The scheme
+ * searches this lattice level by level (keeping at most `beamWidth` states
+ * per level, if set) and applies the first operation on the way to the
+ * smallest state on the last level. States in the lattice are cached and
+ * remain valid as long as they are still reachable after an operation has
+ * been applied.
+ */
 class LookaheadApplicationScheme final
     : public ApplicationScheme<dd::MatrixDD> {
 public:
   LookaheadApplicationScheme(TaskManager<dd::MatrixDD>& tm1,
                              TaskManager<dd::MatrixDD>& tm2) noexcept;
 
+  ~LookaheadApplicationScheme() override;
+
+  LookaheadApplicationScheme(const LookaheadApplicationScheme&) = delete;
+  LookaheadApplicationScheme&
+  operator=(const LookaheadApplicationScheme&) = delete;
+  LookaheadApplicationScheme(LookaheadApplicationScheme&&) = delete;
+  LookaheadApplicationScheme& operator=(LookaheadApplicationScheme&&) = delete;
+
   void setInternalState(dd::MatrixDD& state) noexcept;
   void setPackage(dd::Package* dd) noexcept;
+  void setGarbageCollector(GarbageCollector* collector) noexcept;
+
+  /// \param lookaheadDepth The number of operations to look ahead.
+  /// \param lookaheadBeamWidth The maximum number of states kept per level of
+  /// the search (0 keeps all states).
+  /// \param estimateSizes Whether to compare upper bounds on the sizes of the
+  /// states instead of constructing them.
+  void setSearch(std::size_t lookaheadDepth, std::size_t lookaheadBeamWidth,
+                 bool estimateSizes) noexcept;
 
   // in general, the lookup application scheme will apply a single operation of
   // either circuit for every invocation. manipulation of the state is handled
   // directly by the application scheme. Thus, the return value is always {0,0}.
   std::pair<size_t, size_t> operator()() override;
 
+  /// Release the cached states of the lattice and the upcoming operations so
+  /// that the package can collect them (e.g., once one of the circuits has
+  /// been processed completely). A subsequent invocation starts the search
+  /// from scratch.
+  void release();
+
 private:
-  dd::MatrixDD op1{};
-  bool cached1 = false;
+  // number of operations applied from either circuit (relative to the
+  // internal state)
+  using Position = std::pair<std::size_t, std::size_t>;
+
+  struct Candidate {
+    Position position;
+    Position parent;
+    double score;
+  };
+
+  std::size_t depth = 1U;
+  std::size_t beamWidth = 0U;
+  bool estimate = false;
 
-  dd::MatrixDD op2{};
-  bool cached2 = false;
+  // copies of the task managers that run ahead of the original ones and
+  // provide the upcoming operations of both circuits
+  std::unique_ptr<TaskManager<dd::MatrixDD>> peek1;
+  std::unique_ptr<TaskManager<dd::MatrixDD>> peek2;
+  std::deque<dd::MatrixDD> upcoming1;
+  std::deque<dd::MatrixDD> upcoming2;
+
+  // states of the lattice computed so far (except for the internal state)
+  std::map<Position, dd::MatrixDD> lattice;
 
   // the lookahead application scheme maintains links to an internal state to
   // manipulate and a package to use
   dd::MatrixDD* internalState{};
   dd::Package* package{};
+  // collects garbage after every application if not set
+  GarbageCollector* garbageCollector{};
+
+  /// Make sure that `count` upcoming operations of the respective circuit are
+  /// available. Returns false if the circuit has fewer operations left.
+  bool available(bool first, std::size_t count);
+
+  /// Returns the state at the given position (computing it from the state at
+  /// the parent position if necessary)
+  const dd::MatrixDD& state(const Position& position, const Position& parent);
+
+  double score(const Candidate& parent, const Position& position);
+
+  /// Search the lattice and return whether to apply an operation of the first
+  /// circuit
+  bool search();
+
+  void step(bool first);
 };
 } // namespace ec
@@ -11,13 +11,31 @@
 #pragma once
 
 #include "StateType.hpp"
-#include "dd/Package_fwd.hpp"
+#include "dd/Package.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <random>
 #include <unordered_set>
+#include <vector>
 
 namespace ec {
+/**
+ * @brief A package-independent description of a random stimulus.
+ * @details Drawing a stimulus only consumes randomness from the generator,
+ * while building the corresponding decision diagram can happen later (and on a
+ * different thread) in whatever package is supposed to hold the state.
+ */
+struct Stimulus {
+  StateType type = StateType::ComputationalBasis;
+  std::size_t totalQubits = 0U;
+  std::size_t ancillaryQubits = 0U;
+  /// the basis state of each qubit (computational basis and 1Q basis states)
+  std::vector<dd::BasisStates> basis;
+  /// the seed of the random Clifford circuit (stabilizer states)
+  std::uint64_t seed = 0U;
+};
+
 class StateGenerator {
 public:
   explicit StateGenerator(const std::size_t s) : seed(s) {
@@ -43,6 +61,16 @@ public:
                                              std::size_t totalQubits,
                                              std::size_t ancillaryQubits = 0U);
 
+  /// \brief Draw a random stimulus without constructing its decision diagram.
+  /// \details The random numbers are consumed in exactly the same order as by
+  /// the corresponding `generateRandom*` method.
+  Stimulus drawRandomStimulus(std::size_t totalQubits,
+                              std::size_t ancillaryQubits = 0U,
+                              StateType type = StateType::ComputationalBasis);
+
+  /// Construct the decision diagram of a previously drawn stimulus
+  static dd::VectorDD buildStimulus(dd::Package& dd, const Stimulus& stimulus);
+
   void seedGenerator(std::size_t s);
 
   void clear() { generatedComputationalBasisStates.clear(); }
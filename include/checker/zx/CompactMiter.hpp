@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "zx/ZXDefinitions.hpp"
+#include "zx/ZXDiagram.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief A compact mirror of the structure of a ZX diagram.
+ * @details The adjacency of all vertices is stored in a single array (in
+ * compressed sparse row format) and the properties of the vertices that the
+ * simplification rules depend on are stored in separate arrays. In contrast
+ * to the vertices and edges of a zx::ZXDiagram, which are scattered across the
+ * heap, the data accessed while searching for matches of the rules is thus
+ * kept close together.
+ *
+ * The mirror has to be updated for every vertex that is changed in the
+ * diagram. A vertex whose adjacency no longer fits into its slot of the array
+ * is moved to the end of the array, leaving a tombstone behind. Deleted
+ * vertices are tombstoned as well. Once tombstones make up more than half of
+ * the array, it is compacted.
+ */
+class CompactMiter {
+public:
+  /// Rebuild the mirror of the whole diagram
+  void rebuild(const zx::ZXDiagram& diag);
+
+  /// Update the mirror of a single vertex
+  void update(const zx::ZXDiagram& diag, zx::Vertex v);
+
+  /// Returns the number of vertex ids (including those of deleted vertices)
+  [[nodiscard]] std::size_t size() const noexcept { return flags.size(); }
+
+  [[nodiscard]] bool isDeleted(const zx::Vertex v) const {
+    return v >= flags.size() || (flags[v] & DELETED) != 0U;
+  }
+  [[nodiscard]] zx::VertexType type(const zx::Vertex v) const {
+    return types[v];
+  }
+  [[nodiscard]] bool isBoundary(const zx::Vertex v) const {
+    return types[v] == zx::VertexType::Boundary;
+  }
+  [[nodiscard]] bool hasZeroPhase(const zx::Vertex v) const {
+    return (flags[v] & ZERO) != 0U;
+  }
+  [[nodiscard]] bool hasPauliPhase(const zx::Vertex v) const {
+    return (flags[v] & PAULI) != 0U;
+  }
+  [[nodiscard]] bool hasProperCliffordPhase(const zx::Vertex v) const {
+    return (flags[v] & PROPER_CLIFFORD) != 0U;
+  }
+
+  // the edges incident to `v` are stored at the positions
+  // [offset(v), offset(v) + degree(v)) of the adjacency array
+  [[nodiscard]] std::size_t offset(const zx::Vertex v) const {
+    return offsets[v];
+  }
+  [[nodiscard]] std::size_t degree(const zx::Vertex v) const {
+    return degrees[v];
+  }
+  [[nodiscard]] zx::Vertex target(const std::size_t pos) const {
+    return targets[pos];
+  }
+  [[nodiscard]] zx::EdgeType edgeType(const std::size_t pos) const {
+    return edgeTypes[pos];
+  }
+
+private:
+  static constexpr std::uint8_t DELETED = 1U;
+  static constexpr std::uint8_t ZERO = 2U;
+  static constexpr std::uint8_t PAULI = 4U;
+  static constexpr std::uint8_t PROPER_CLIFFORD = 8U;
+
+  // minimum size of the adjacency array before it is compacted
+  static constexpr std::size_t MIN_COMPACTION_SIZE = 1024U;
+
+  // per vertex
+  std::vector<std::uint8_t> flags;
+  std::vector<zx::VertexType> types;
+  std::vector<std::size_t> offsets;
+  std::vector<std::size_t> degrees;
+  std::vector<std::size_t> capacities;
+
+  // adjacency array
+  std::vector<zx::Vertex> targets;
+  std::vector<zx::EdgeType> edgeTypes;
+  // number of entries of the adjacency array that are not used by any vertex
+  std::size_t tombstones = 0U;
+
+  void reserve(std::size_t nvertices);
+  void compact();
+};
+} // namespace ec
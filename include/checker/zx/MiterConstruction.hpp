@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/QuantumComputation.hpp"
+#include "zx/FunctionalityConstruction.hpp"
+#include "zx/ZXDefinitions.hpp"
+#include "zx/ZXDiagram.hpp"
+
+#include <unordered_map>
+
+namespace ec {
+/**
+ * @brief Constructs the miter D_2 D_1^† of two circuits as a single ZX
+ * diagram.
+ * @details The diagram D_1 of the first circuit is constructed as usual, its
+ * ancillaries are fixed to |0>, and it is inverted in place. Instead of
+ * constructing a second diagram for the second circuit and concatenating both
+ * (which copies every vertex and edge of the second diagram), the operations
+ * of the second circuit are directly appended to the outputs of D_1^†. Its
+ * ancillaries are fixed to |0> on the fly.
+ */
+class MiterConstruction : protected zx::FunctionalityConstruction {
+public:
+  struct Miter {
+    zx::ZXDiagram diagram;
+    // the qubit of the second circuit that every output of the miter belongs
+    // to
+    std::unordered_map<zx::Vertex, zx::Qubit> outputQubits;
+  };
+
+  static Miter build(const qc::QuantumComputation& qc1,
+                     const qc::QuantumComputation& qc2);
+};
+} // namespace ec
@@ -13,14 +13,17 @@
 #include "Configuration.hpp"
 #include "EquivalenceCriterion.hpp"
 #include "checker/EquivalenceChecker.hpp"
+#include "checker/zx/CompactMiter.hpp"
 #include "ir/Permutation.hpp"
 #include "ir/QuantumComputation.hpp"
-#include "zx/Rules.hpp"
 #include "zx/ZXDefinitions.hpp"
 #include "zx/ZXDiagram.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <nlohmann/json.hpp>
+#include <optional>
+#include <unordered_map>
 
 namespace ec {
 class ZXEquivalenceChecker : public EquivalenceChecker {
@@ -31,6 +34,12 @@ public:
 
   EquivalenceCriterion run() override;
 
+  /// The matches of the simplification rules are searched concurrently
+  [[nodiscard]] static std::size_t
+  parallelism(const Configuration& config) noexcept {
+    return std::max(config.execution.zxThreads, std::size_t{1U});
+  }
+
   void json(nlohmann::basic_json<>& j) const noexcept override {
     EquivalenceChecker::json(j);
     j["checker"] = "zx";
@@ -38,79 +47,61 @@ public:
 
 private:
   zx::ZXDiagram miter;
+  // compact mirror of the miter used while searching for matches of the
+  // simplification rules
+  CompactMiter compact;
   zx::fp tolerance;
   bool ancilla = false;
 
+  // the permutations that the qubits of the inputs and the outputs of the
+  // miter have to be subject to for the miter to be the identity
+  qc::Permutation inputPermutation;
+  qc::Permutation outputPermutation;
+  std::unordered_map<zx::Vertex, std::size_t> inputIndices;
+  // the qubit of the second circuit that every output of the miter belongs to
+  std::unordered_map<zx::Vertex, zx::Qubit> outputQubits;
+  // whether some boundary is wired in a way that is inconsistent with the
+  // identity, in which case the simplification is stopped early
+  bool miswired = false;
+
+  /// Returns whether the i-th input is directly connected to the output it has
+  /// to be connected to (or the qubit is garbage in both circuits). Returns
+  /// std::nullopt if the input is not (yet) directly connected to another
+  /// boundary.
+  [[nodiscard]] std::optional<bool> wiredToIdentity(std::size_t i) const;
+
+  /// Returns whether the given vertex is a boundary that is directly
+  /// connected to another boundary in a way that is inconsistent with the
+  /// identity. Since no rule rewrites edges between boundaries, such a miter
+  /// can no longer be reduced to the identity.
+  [[nodiscard]] bool isMiswired(zx::Vertex v) const;
+
+  [[nodiscard]] bool stopSimplification() const {
+    return isDone() || miswired;
+  }
+
   // the following methods are adaptations of the core ZX simplification
   // routines that additionally check a criterion for early termination of the
-  // simplification.
+  // simplification (see `stopSimplification`).
   bool fullReduceApproximate();
   bool fullReduce();
 
-  bool gadgetSimp();
-  bool interiorCliffordSimp();
-  bool cliffordSimp();
-
-  bool idSimp() { return simplifyVertices(zx::checkIdSimp, zx::removeId); }
-
-  bool spiderSimp() {
-    return simplifyEdges(zx::checkSpiderFusion, zx::fuseSpiders);
-  }
-
-  bool localCompSimp() {
-    return simplifyVertices(zx::checkLocalComp, zx::localComp);
-  }
-
-  bool pivotPauliSimp() {
-    return simplifyEdges(zx::checkPivotPauli, zx::pivotPauli);
-  }
-
-  bool pivotSimp() { return simplifyEdges(zx::checkPivot, zx::pivot); }
-
-  bool pivotGadgetSimp() {
-    return simplifyEdges(zx::checkPivotGadget, zx::pivotGadget);
-  }
-
-  template <class CheckFun, class RuleFun>
-  bool simplifyVertices(CheckFun check, RuleFun rule) {
-    auto simplified = false;
-    while (!isDone()) {
-      auto moreSimplified = false;
-      for (const auto& [v, _] : miter.getVertices()) {
-        if (isDone() || !check(miter, v)) {
-          continue;
-        }
-        rule(miter, v);
-        moreSimplified = true;
-      }
-      if (!moreSimplified) {
-        break;
-      }
-      simplified = true;
-    }
-    return simplified;
-  }
-
-  template <class CheckFun, class RuleFun>
-  bool simplifyEdges(CheckFun check, RuleFun rule) {
-    auto simplified = false;
-    while (!isDone()) {
-      auto moreSimplified = false;
-      for (const auto& [v0, v1] : miter.getEdges()) {
-        if (isDone() || miter.isDeleted(v0) || miter.isDeleted(v1) ||
-            !check(miter, v0, v1)) {
-          continue;
-        }
-        rule(miter, v0, v1);
-        moreSimplified = true;
-      }
-      if (!moreSimplified) {
-        break;
-      }
-      simplified = true;
-    }
-    return simplified;
-  }
+  /**
+   * @brief Apply the simplification rules until none of them is applicable.
+   * @details Instead of repeatedly sweeping over the whole diagram, a worklist
+   * of vertices is kept for every rule. Initially, it contains all vertices.
+   * Whenever a rule is applied, only the vertices in the rewritten
+   * neighbourhood (and the edges incident to them) are checked again. The
+   * rule with the highest priority whose worklist is not empty is tried next,
+   * so that, e.g., spiders are fused before any pivoting takes place.
+   *
+   * If more than one thread is configured, all vertices in the worklist of a
+   * rule are searched for matches concurrently (without changing the diagram).
+   * Afterwards, a maximal set of matches whose neighbourhoods do not overlap is
+   * applied one after another. Since none of these matches can affect the
+   * others, they do not have to be checked again.
+   */
+  bool simplify();
 };
 
 qc::Permutation complete(const qc::Permutation& p, std::size_t n);
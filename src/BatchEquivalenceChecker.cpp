@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "BatchEquivalenceChecker.hpp"
+
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "ThreadPool.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ec {
+namespace {
+/// Thread pools of equal size for the pairs that are checked in parallel at
+/// once. Each check leases one of the pools for its duration.
+class PoolSlices {
+public:
+  /// Create the given number of pools (none if the pairs are checked
+  /// sequentially)
+  PoolSlices(const std::size_t count, const std::size_t threads)
+      : enabled(count > 0U) {
+    pools.reserve(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+      pools.emplace_back(std::make_shared<ThreadPool>(threads));
+    }
+  }
+
+  // returns the leased pool once the lease ends
+  class Lease {
+  public:
+    explicit Lease(PoolSlices& s) : slices(&s) { leased = s.acquire(); }
+    ~Lease() { slices->release(std::move(leased)); }
+
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+
+    /// Returns the leased pool (null if the pairs are checked sequentially)
+    [[nodiscard]] const std::shared_ptr<ThreadPool>& pool() const noexcept {
+      return leased;
+    }
+
+  private:
+    PoolSlices* slices;
+    std::shared_ptr<ThreadPool> leased;
+  };
+
+private:
+  bool enabled;
+  std::vector<std::shared_ptr<ThreadPool>> pools;
+  std::mutex mutex;
+  std::condition_variable cond;
+
+  std::shared_ptr<ThreadPool> acquire() {
+    if (!enabled) {
+      return nullptr;
+    }
+    // a pool shared with the batch might run more checks at once than there
+    // are slices
+    std::unique_lock lock(mutex);
+    cond.wait(lock, [this] { return !pools.empty(); });
+    auto pool = std::move(pools.back());
+    pools.pop_back();
+    return pool;
+  }
+
+  void release(std::shared_ptr<ThreadPool> pool) {
+    if (!pool) {
+      return;
+    }
+    {
+      const std::lock_guard lock(mutex);
+      pools.emplace_back(std::move(pool));
+    }
+    cond.notify_one();
+  }
+};
+} // namespace
+
+std::size_t
+BatchEquivalenceChecker::addPair(const qc::QuantumComputation& circ1,
+                                 const qc::QuantumComputation& circ2) {
+  pairs.emplace_back(&circ1, &circ2);
+  return pairs.size() - 1U;
+}
+
+void BatchEquivalenceChecker::clear() {
+  pairs.clear();
+  results.clear();
+  managers.clear();
+}
+
+void BatchEquivalenceChecker::run(const ResultCallback& onResult) {
+  results.assign(pairs.size(), Results{});
+  managers.clear();
+  managers.resize(pairs.size());
+  if (pairs.empty()) {
+    return;
+  }
+
+  const auto budget =
+      std::max(configuration.execution.nthreads, static_cast<std::size_t>(1U));
+  if (!threadPool) {
+    threadPool = std::make_shared<ThreadPool>(std::min(budget, pairs.size()));
+  }
+
+  // distribute the thread budget among the pairs that are checked at once
+  auto pairConfiguration = configuration;
+  const auto concurrentPairs = std::min(budget, pairs.size());
+  const auto threadsPerPair = budget / concurrentPairs;
+  if (threadsPerPair > 1U) {
+    pairConfiguration.execution.nthreads = threadsPerPair;
+  } else {
+    pairConfiguration.execution.parallel = false;
+    pairConfiguration.execution.nthreads = 1U;
+  }
+  PoolSlices slices(threadsPerPair > 1U ? concurrentPairs : 0U,
+                    threadsPerPair);
+
+  std::mutex callbackMutex;
+  std::vector<std::future<void>> futures;
+  futures.reserve(pairs.size());
+  for (std::size_t i = 0U; i < pairs.size(); ++i) {
+    futures.emplace_back(threadPool->submit([&, i]() {
+      const auto& [circ1, circ2] = pairs[i];
+      auto manager = std::make_unique<EquivalenceCheckingManager>(
+          *circ1, *circ2, pairConfiguration);
+      {
+        const PoolSlices::Lease lease(slices);
+        if (lease.pool()) {
+          manager->setThreadPool(lease.pool());
+        }
+        manager->run();
+        // the slice is handed to the next pair
+        manager->setThreadPool(nullptr);
+      }
+      results[i] = manager->getResults();
+      // counterexamples refer to the decision diagram packages of the manager
+      if (results[i].equivalence == EquivalenceCriterion::NotEquivalent) {
+        managers[i] = std::move(manager);
+      }
+      if (onResult) {
+        const std::lock_guard lock(callbackMutex);
+        onResult(i, results[i]);
+      }
+    }));
+  }
+
+  // wait for all checks (even if one of them fails) before propagating the
+  // first exception, since all of them reference local state
+  std::exception_ptr error{};
+  for (auto& future : futures) {
+    try {
+      future.get();
+    } catch (...) {
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+} // namespace ec
@@ -11,6 +11,7 @@
 #include "Configuration.hpp"
 
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "checker/dd/GarbageCollectionPolicy.hpp"
 #include "checker/dd/simulation/StateType.hpp"
 
 #include <nlohmann/json.hpp>
@@ -31,6 +32,12 @@ bool Configuration::onlySingleTask() const noexcept {
     return true;
   }
 
+  // racing several alternating checkers requires the parallel flow
+  if (execution.runAlternatingChecker &&
+      application.alternatingPortfolio.size() > 1U) {
+    return false;
+  }
+
   // no simulations and only one of the other checks shall be performed
   if (!execution.runSimulationChecker &&
       ((execution.runAlternatingChecker && !execution.runConstructionChecker &&
@@ -66,6 +73,20 @@ nlohmann::basic_json<> Configuration::json() const {
   exe["run_alternating_checker"] = execution.runAlternatingChecker;
   exe["run_zx_checker"] = execution.runZXChecker;
   exe["timeout"] = execution.timeout;
+  exe["gate_cache_size"] = execution.gateCacheSize;
+  exe["gc_policy"] = ec::toString(execution.gcPolicy);
+  exe["gc_interval"] = execution.gcInterval;
+  exe["gc_load_factor"] = execution.gcLoadFactor;
+  exe["gc_high_water_mark"] = execution.gcHighWaterMark;
+  exe["memory_budget"] = execution.memoryBudget;
+  exe["adaptive_table_sizing"] = execution.adaptiveTableSizing;
+  exe["unique_table_buckets"] = execution.uniqueTableBuckets;
+  exe["compute_table_buckets"] = execution.computeTableBuckets;
+  exe["cancellation_grace_period"] = execution.cancellationGracePeriod;
+  exe["reassign_idle_threads"] = execution.reassignIdleThreads;
+  exe["construction_segments"] = execution.constructionSegments;
+  exe["split_miters"] = execution.splitMiters;
+  exe["zx_threads"] = execution.zxThreads;
 
   auto& opt = config["optimizations"];
   opt["fuse_consecutive_single_qubit_gates"] =
@@ -83,6 +104,19 @@ nlohmann::basic_json<> Configuration::json() const {
   app["construction"] = ec::toString(application.constructionScheme);
   app["simulation"] = ec::toString(application.simulationScheme);
   app["alternating"] = ec::toString(application.alternatingScheme);
+  if (!application.alternatingPortfolio.empty()) {
+    auto& portfolio = app["alternating_portfolio"];
+    for (const auto scheme : application.alternatingPortfolio) {
+      portfolio.emplace_back(ec::toString(scheme));
+    }
+  }
+  app["cancellation_window"] = application.cancellationWindow;
+  if (application.alternatingScheme == ApplicationSchemeType::Lookahead) {
+    auto& lookahead = app["lookahead"];
+    lookahead["depth"] = application.lookaheadDepth;
+    lookahead["beam_width"] = application.lookaheadBeamWidth;
+    lookahead["size_estimate"] = application.lookaheadSizeEstimate;
+  }
   if (!application.profile.empty()) {
     app["profile"] = application.profile;
   } else {
@@ -102,6 +136,10 @@ nlohmann::basic_json<> Configuration::json() const {
   sim["max_sims"] = simulation.maxSims;
   sim["state_type"] = ec::toString(simulation.stateType);
   sim["seed"] = simulation.seed;
+  sim["persistent_workers"] = simulation.persistentWorkers;
+  sim["batch_size"] = simulation.batchSize;
+  sim["adaptive_sims"] = simulation.adaptiveSims;
+  sim["initial_sims"] = simulation.initialSims;
 
   return config;
 }
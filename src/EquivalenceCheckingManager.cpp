@@ -11,20 +11,24 @@
 #include "EquivalenceCheckingManager.hpp"
 
 #include "EquivalenceCriterion.hpp"
-#include "ThreadSafeQueue.hpp"
+#include "NumericalToleranceLock.hpp"
+#include "StopToken.hpp"
+#include "ThreadPool.hpp"
 #include "checker/dd/DDAlternatingChecker.hpp"
+#include "checker/dd/DDBatchSimulationChecker.hpp"
 #include "checker/dd/DDConstructionChecker.hpp"
 #include "checker/dd/DDSimulationChecker.hpp"
+#include "checker/dd/MiterSplittingChecker.hpp"
 #include "checker/dd/simulation/StateType.hpp"
 #include "checker/zx/ZXChecker.hpp"
 #include "circuit_optimizer/CircuitOptimizer.hpp"
-#include "dd/ComplexNumbers.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/Permutation.hpp"
 #include "ir/QuantumComputation.hpp"
 #include "zx/FunctionalityConstruction.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
@@ -303,7 +307,26 @@ void EquivalenceCheckingManager::runOptimizationPasses() {
 }
 
 void EquivalenceCheckingManager::run() {
+  // checkers abandoned in a previous run still reference the manager's state
+  joinAbandonedTasks();
+  stopSource = StopSource{};
+
+  // the numerical tolerance is a process-wide setting. Holding the lock makes
+  // sure that it is not changed by concurrent checks with another tolerance.
+  // The tasks of the parallel flow share the lock, so that checkers abandoned
+  // after the cancellation grace period keep holding it until they finish.
+  const auto lock = std::make_shared<const NumericalToleranceLock>(
+      configuration.execution.numericalTolerance);
+  toleranceLock = lock;
+
   done = false;
+  simulationAborted = false;
+
+  // a batch always consists of at least one simulation
+  if (configuration.simulation.batchSize == 0U) {
+    configuration.simulation.batchSize = 1U;
+  }
+  simulationLimit = configuration.simulation.maxSims;
 
   results.equivalence = EquivalenceCriterion::NoInformation;
 
@@ -333,7 +356,13 @@ void EquivalenceCheckingManager::run() {
     checkSymbolic();
   }
 
-  for (const auto& checker : checkers) {
+  for (std::size_t i = 0U; i < checkers.size(); ++i) {
+    const auto& checker = checkers[i];
+    // checkers scheduled after a result has been determined are never created
+    // and abandoned checkers might still be running
+    if (!checker || isAbandoned(i)) {
+      continue;
+    }
     nlohmann::basic_json j{};
     checker->json(j);
     results.checkerResults.emplace_back(j);
@@ -358,9 +387,6 @@ EquivalenceCheckingManager::EquivalenceCheckingManager(
     : qc1(circ1), qc2(circ2), configuration(std::move(config)) {
   const auto start = std::chrono::steady_clock::now();
 
-  // set numeric tolerance used throughout the check
-  dd::ComplexNumbers::setTolerance(configuration.execution.numericalTolerance);
-
   if (qc1.isVariableFree() && qc2.isVariableFree()) {
     // run all configured optimization passes
     runOptimizationPasses();
@@ -408,6 +434,10 @@ EquivalenceCheckingManager::EquivalenceCheckingManager(
       std::chrono::duration<double>(end - start).count();
 }
 
+EquivalenceCheckingManager::~EquivalenceCheckingManager() {
+  joinAbandonedTasks();
+}
+
 void EquivalenceCheckingManager::checkSequential() {
   const auto start = std::chrono::steady_clock::now();
 
@@ -429,18 +459,42 @@ void EquivalenceCheckingManager::checkSequential() {
   }
 
   if (configuration.execution.runSimulationChecker) {
-    checkers.emplace_back(
-        std::make_unique<DDSimulationChecker>(qc1, qc2, configuration));
-    auto* const simulationChecker =
-        dynamic_cast<DDSimulationChecker*>(checkers.back().get());
+    if (configuration.simulation.batchSize > 1U) {
+      checkers.emplace_back(
+          std::make_unique<DDBatchSimulationChecker>(qc1, qc2, configuration));
+    } else {
+      checkers.emplace_back(
+          std::make_unique<DDSimulationChecker>(qc1, qc2, configuration));
+    }
+    const auto& simulationChecker = checkers.back();
     while (!simulationsFinished() && !done) {
       // configure simulation based checker
-      simulationChecker->setRandomInitialState(stateGenerator);
+      std::size_t count = 1U;
+      if (auto* const batchChecker = dynamic_cast<DDBatchSimulationChecker*>(
+              simulationChecker.get())) {
+        count = std::min(configuration.simulation.batchSize,
+                         configuration.simulation.maxSims -
+                             results.performedSimulations);
+        batchChecker->setRandomInitialStates(stateGenerator, count);
+      } else {
+        dynamic_cast<DDSimulationChecker*>(simulationChecker.get())
+            ->setRandomInitialState(stateGenerator);
+      }
 
       // run the simulation
-      ++results.startedSimulations;
+      results.startedSimulations += count;
       const auto result = simulationChecker->run();
-      ++results.performedSimulations;
+
+      // a simulation that exceeded its memory budget is not counted. The
+      // remaining simulations would most likely exceed it as well, so they are
+      // skipped, while the remaining checkers still get their chance.
+      if (simulationChecker->aborted()) {
+        std::clog << "Simulation aborted: "
+                  << simulationChecker->getAbortReason() << "\n";
+        results.simulationsAborted = true;
+        break;
+      }
+      results.performedSimulations += count;
 
       // if the run completed but has not yielded any information this
       // indicates a timeout
@@ -465,9 +519,7 @@ void EquivalenceCheckingManager::checkSequential() {
 
     // Circuits are non-equivalent
     if (results.equivalence == EquivalenceCriterion::NotEquivalent) {
-      results.cexInput = simulationChecker->getInitialState();
-      results.cexOutput1 = simulationChecker->getInternalState1();
-      results.cexOutput2 = simulationChecker->getInternalState2();
+      setCounterexample(simulationChecker.get());
       done = true;
       doneCond.notify_one();
     }
@@ -482,9 +534,18 @@ void EquivalenceCheckingManager::checkSequential() {
   }
 
   if (configuration.execution.runAlternatingChecker && !done) {
-    checkers.emplace_back(
-        std::make_unique<DDAlternatingChecker>(qc1, qc2, configuration));
+    if (configuration.execution.splitMiters) {
+      checkers.emplace_back(
+          std::make_unique<MiterSplittingChecker>(qc1, qc2, configuration));
+    } else {
+      checkers.emplace_back(
+          std::make_unique<DDAlternatingChecker>(qc1, qc2, configuration));
+    }
     const auto& alternatingChecker = checkers.back();
+    if (configuration.execution.splitMiters) {
+      lendThreadPool(*alternatingChecker,
+                     MiterSplittingChecker::parallelism(configuration));
+    }
     if (!done) {
       const auto result = alternatingChecker->run();
 
@@ -503,6 +564,8 @@ void EquivalenceCheckingManager::checkSequential() {
     checkers.emplace_back(
         std::make_unique<DDConstructionChecker>(qc1, qc2, configuration));
     const auto& constructionChecker = checkers.back();
+    lendThreadPool(*constructionChecker,
+                   DDConstructionChecker::parallelism(configuration));
     if (!done) {
       const auto result = constructionChecker->run();
 
@@ -523,6 +586,8 @@ void EquivalenceCheckingManager::checkSequential() {
       checkers.emplace_back(
           std::make_unique<ZXEquivalenceChecker>(qc1, qc2, configuration));
       const auto& zxChecker = checkers.back();
+      lendThreadPool(*zxChecker,
+                     ZXEquivalenceChecker::parallelism(configuration));
       if (!done) {
         const auto result = zxChecker->run();
 
@@ -545,9 +610,11 @@ void EquivalenceCheckingManager::checkSequential() {
           }
         } else {
           assert(result == EquivalenceCriterion::NoInformation);
-          if (results.equivalence == EquivalenceCriterion::NoInformation) {
-            // this can only happen if the ZX checker is the only checker
-            assert(configuration.onlyZXCheckerConfigured());
+          // other checkers might have been aborted (e.g., because they
+          // exceeded their memory budget), in which case no information is
+          // available either
+          if (results.equivalence == EquivalenceCriterion::NoInformation &&
+              configuration.onlyZXCheckerConfigured()) {
             std::clog
                 << "Only ZX checker specified, but it was not able to conclude "
                    "anything about the equivalence of the circuits!\n"
@@ -595,16 +662,24 @@ void EquivalenceCheckingManager::checkParallel() {
   }
   const auto maxThreads = configuration.execution.nthreads;
 
-  std::size_t tasksToExecute = 0U;
+  // the application schemes raced by the alternating checkers
+  std::vector<ApplicationSchemeType> portfolio{};
   if (configuration.execution.runAlternatingChecker) {
-    ++tasksToExecute;
+    for (const auto scheme : configuration.application.alternatingPortfolio) {
+      if (std::find(portfolio.begin(), portfolio.end(), scheme) ==
+          portfolio.end()) {
+        portfolio.emplace_back(scheme);
+      }
+    }
+    if (portfolio.empty()) {
+      portfolio.emplace_back(configuration.application.alternatingScheme);
+    }
   }
+
+  std::size_t tasksToExecute = 0U;
   if (configuration.execution.runConstructionChecker) {
     ++tasksToExecute;
   }
-  if (configuration.execution.runSimulationChecker) {
-    tasksToExecute += configuration.simulation.maxSims;
-  }
   if (configuration.execution.runZXChecker) {
     if (zx::FunctionalityConstruction::transformableToZX(&qc1) &&
         zx::FunctionalityConstruction::transformableToZX(&qc2)) {
@@ -613,58 +688,266 @@ void EquivalenceCheckingManager::checkParallel() {
       configuration.execution.runZXChecker = false;
     }
   }
+  // the portfolio is trimmed so that the construction and the ZX checker still
+  // get a slot of their own (as long as there are enough threads at all)
+  if (portfolio.size() + tasksToExecute > maxThreads) {
+    portfolio.resize(std::max(maxThreads, tasksToExecute + 1U) -
+                     tasksToExecute);
+  }
+  tasksToExecute += portfolio.size();
+  // checkers that split up their work run parts of it on the threads of the
+  // pool that are not occupied by any other task
+  std::size_t helperThreads = 0U;
+  if (configuration.execution.runConstructionChecker) {
+    helperThreads += DDConstructionChecker::parallelism(configuration) - 1U;
+  }
+  if (configuration.execution.runAlternatingChecker &&
+      configuration.execution.splitMiters) {
+    helperThreads += MiterSplittingChecker::parallelism(configuration) - 1U;
+  }
+  if (configuration.execution.runZXChecker) {
+    helperThreads += ZXEquivalenceChecker::parallelism(configuration) - 1U;
+  }
+  // each simulation task processes a whole batch of simulations
+  const auto simulationTasks = (configuration.simulation.maxSims +
+                                configuration.simulation.batchSize - 1U) /
+                               configuration.simulation.batchSize;
+  if (configuration.execution.runSimulationChecker) {
+    tasksToExecute += simulationTasks;
+  }
 
   const auto effectiveThreads = std::min(maxThreads, tasksToExecute);
 
   // reserve space for as many equivalence checkers as there will be
   // parallel threads
   checkers.resize(effectiveThreads);
+  // (value-initialized, i.e., no slot runs an alternating checker yet)
+  alternatingCheckers =
+      std::vector<std::atomic<const EquivalenceChecker*>>(effectiveThreads);
+
+  // (re-)create the thread pool if none has been provided or the one owned by
+  // this manager is too small for the requested degree of parallelism
+  const auto poolThreads = std::min(maxThreads, tasksToExecute + helperThreads);
+  if (!threadPool || (ownsThreadPool && threadPool->size() < poolThreads)) {
+    threadPool = std::make_shared<ThreadPool>(poolThreads);
+    ownsThreadPool = true;
+  }
 
-  // create a thread safe queue which is used to check for available results
-  ThreadSafeQueue<std::size_t> queue{};
+  // create a channel which is used to check for available results. Every
+  // running task pushes exactly once, so the channel never holds more than
+  // one entry per slot. Since tasks might be abandoned, they share ownership
+  // of the channel.
+  const auto queue = std::make_shared<CompletionQueue>(effectiveThreads);
   std::size_t id = 0U;
 
-  // reserve space for the futures received from the async calls
+  // reserve space for the futures received from the thread pool
   std::vector<std::future<void>> futures{};
   futures.reserve(effectiveThreads);
 
-  if (configuration.execution.runAlternatingChecker) {
-    // start a new thread that constructs and runs the alternating check
-    futures.emplace_back(asyncRunChecker<DDAlternatingChecker>(id, queue));
+  // In contrast to `std::async`, futures obtained from the thread pool do not
+  // block in their destructor. Since the tasks reference the manager, all of
+  // them are cancelled and waited for (at most for the configured grace period)
+  // before leaving this function (including the case where an exception is
+  // propagated).
+  struct TaskGuard {
+    EquivalenceCheckingManager& manager;
+    std::vector<std::future<void>>& tasks;
+    ~TaskGuard() {
+      manager.setAndSignalDone();
+      manager.awaitTasks(tasks);
+    }
+  };
+  const TaskGuard taskGuard{*this, futures};
+
+  // application schemes of the alternating checkers started in this run (by
+  // slot)
+  std::vector<std::optional<ApplicationSchemeType>> alternatingSchemes(
+      effectiveThreads);
+  // start an alternating checker with the given scheme in the given slot
+  const auto startAlternatingChecker = [&](const std::size_t slot,
+                                           const ApplicationSchemeType scheme) {
+    alternatingSchemes[slot] = scheme;
+    if (scheme == configuration.application.alternatingScheme) {
+      if (configuration.execution.splitMiters) {
+        return asyncRunChecker<MiterSplittingChecker>(slot, queue);
+      }
+      return asyncRunChecker<DDAlternatingChecker>(slot, queue);
+    }
+    auto config = std::make_shared<Configuration>(configuration);
+    config->application.alternatingScheme = scheme;
+    return asyncRunChecker<DDAlternatingChecker>(slot, queue,
+                                                 std::move(config));
+  };
+
+  // start new threads that construct and run the alternating check(s)
+  for (std::size_t i = 0U; i < portfolio.size() && id < effectiveThreads; ++i) {
+    futures.emplace_back(startAlternatingChecker(id, portfolio[i]));
     ++id;
   }
 
-  if (configuration.execution.runConstructionChecker && !done) {
+  if (configuration.execution.runConstructionChecker && !done &&
+      id < effectiveThreads) {
     // start a new thread that constructs and runs the construction check
     futures.emplace_back(asyncRunChecker<DDConstructionChecker>(id, queue));
     ++id;
   }
 
-  if (configuration.execution.runZXChecker && !done) {
+  if (configuration.execution.runZXChecker && !done &&
+      id < effectiveThreads) {
     // start a new thread that constructs and runs the ZX checker
     futures.emplace_back(asyncRunChecker<ZXEquivalenceChecker>(id, queue));
     ++id;
   }
 
+  const bool batchSimulation = configuration.simulation.batchSize > 1U;
+  simulationRuns.assign(checkers.size(), 0U);
+  // start the next simulation (or batch of simulations) in the given slot
+  const auto startSimulation = [&](const std::size_t slot) {
+    const auto count =
+        std::min(configuration.simulation.batchSize,
+                 simulationLimit - results.startedSimulations);
+    simulationRuns[slot] = count;
+    results.startedSimulations += count;
+    if (batchSimulation) {
+      return asyncRunChecker<DDBatchSimulationChecker>(slot, queue);
+    }
+    return asyncRunChecker<DDSimulationChecker>(slot, queue);
+  };
+
+  // with an adaptive stimulus count, only a few simulations are admitted at
+  // first and more are admitted as long as they are expected to pay off.
+  // Persistent workers claim all pre-drawn stimuli, so they always process
+  // `maxSims` stimuli.
+  const bool adaptiveSimulations = configuration.simulation.adaptiveSims &&
+                                   !configuration.simulation.persistentWorkers;
+  if (configuration.execution.runSimulationChecker &&
+      configuration.simulation.adaptiveSims &&
+      configuration.simulation.persistentWorkers) {
+    std::clog << "[QCEC] Warning: adaptive simulations are not supported by "
+                 "persistent simulation workers. Simulating all `maxSims` "
+                 "stimuli instead.\n";
+  }
+  if (adaptiveSimulations) {
+    simulationLimit = std::min(
+        std::max(configuration.simulation.initialSims, std::size_t{1U}),
+        configuration.simulation.maxSims);
+  }
+
+  // slots of finished simulations that have not been restarted yet
+  std::vector<std::size_t> idleSlots{};
+  // start simulations in idle (or so far unused) slots until all simulations
+  // up to the current limit have been started
+  const auto startPendingSimulations = [&]() {
+    std::size_t started = 0U;
+    while (!done && !results.simulationsAborted &&
+           results.startedSimulations < simulationLimit) {
+      if (!idleSlots.empty()) {
+        const auto slot = idleSlots.back();
+        idleSlots.pop_back();
+        futures[slot] = startSimulation(slot);
+      } else if (id < effectiveThreads) {
+        futures.emplace_back(startSimulation(id));
+        ++id;
+      } else {
+        break;
+      }
+      ++started;
+    }
+    return started;
+  };
+
+  // once all simulations are done, let the freed (or so far unused) slots run
+  // alternating checkers with application schemes that are not in use yet
+  const auto reassignIdleSlots = [&]() {
+    constexpr std::array schemes{ApplicationSchemeType::Proportional,
+                                 ApplicationSchemeType::Lookahead,
+                                 ApplicationSchemeType::OneToOne};
+    std::size_t started = 0U;
+    if (!configuration.execution.reassignIdleThreads ||
+        !configuration.execution.runAlternatingChecker) {
+      return started;
+    }
+    for (const auto scheme : schemes) {
+      if (done || (idleSlots.empty() && id >= effectiveThreads)) {
+        break;
+      }
+      if (std::find(alternatingSchemes.begin(), alternatingSchemes.end(),
+                    std::optional{scheme}) != alternatingSchemes.end()) {
+        continue;
+      }
+      if (!idleSlots.empty()) {
+        const auto slot = idleSlots.back();
+        idleSlots.pop_back();
+        // the slot still holds the checker of its last simulation
+        checkers[slot].reset();
+        futures[slot] = startAlternatingChecker(slot, scheme);
+      } else {
+        futures.emplace_back(startAlternatingChecker(id, scheme));
+        ++id;
+      }
+      ++started;
+    }
+    return started;
+  };
+
   if (configuration.execution.runSimulationChecker) {
     const auto effectiveThreadsLeft = effectiveThreads - futures.size();
     const auto simulationsToStart =
-        std::min(effectiveThreadsLeft, configuration.simulation.maxSims);
-    // launch as many simulations as possible
-    for (std::size_t i = 0; i < simulationsToStart && !done; ++i) {
-      futures.emplace_back(asyncRunChecker<DDSimulationChecker>(id, queue));
-      ++id;
-      ++results.startedSimulations;
+        std::min(effectiveThreadsLeft, simulationTasks);
+    if (configuration.simulation.persistentWorkers) {
+      // every worker processes stimuli until all of them have been claimed
+      drawStimuli();
+      for (std::size_t i = 0; i < simulationsToStart && !done; ++i) {
+        if (batchSimulation) {
+          futures.emplace_back(
+              asyncRunSimulationWorker<DDBatchSimulationChecker>(id, queue));
+        } else {
+          futures.emplace_back(
+              asyncRunSimulationWorker<DDSimulationChecker>(id, queue));
+        }
+        ++id;
+      }
+    } else {
+      // launch as many simulations as possible
+      startPendingSimulations();
     }
   }
 
+  // report which scheme won if several alternating checkers have been raced
+  const auto recordAlternatingWinner = [&](const std::size_t slot) {
+    const auto raced = std::count_if(
+        alternatingSchemes.begin(), alternatingSchemes.end(),
+        [](const auto& scheme) { return scheme.has_value(); });
+    if (!alternatingSchemes[slot] || raced <= 1) {
+      return;
+    }
+    auto& schemes = results.alternatingPortfolio["schemes"];
+    for (const auto& scheme : alternatingSchemes) {
+      if (scheme) {
+        schemes.emplace_back(toString(*scheme));
+      }
+    }
+    results.alternatingPortfolio["winner"] =
+        toString(*alternatingSchemes[slot]);
+  };
+
+  // number of tasks whose result has not yet been collected
+  auto runningTasks = futures.size();
+
   // wait in a loop while no definitive result has been obtained
   while (!done) {
-    std::shared_ptr<std::size_t> completedID{};
+    // once all tasks are finished without a definitive result (e.g., because
+    // checkers have been aborted), there is nothing left to wait for
+    if (runningTasks == 0U) {
+      setAndSignalDone();
+      break;
+    }
+
+    std::optional<std::size_t> completedID{};
     if (configuration.execution.timeout > 0.) {
-      completedID = queue.waitAndPopUntil(deadline);
+      completedID = queue->waitAndPopUntil(deadline);
     } else {
-      completedID = queue.waitAndPop();
+      completedID = queue->waitAndPop();
     }
 
     // in case no completed ID has been returned this indicates a timeout
@@ -678,12 +961,54 @@ void EquivalenceCheckingManager::checkParallel() {
     // get the result of the future (which should be ready)
     // this makes sure exceptions are thrown if necessary
     futures.at(*completedID).get();
+    --runningTasks;
+    alternatingCheckers[*completedID].store(nullptr, std::memory_order_relaxed);
 
     // in case non-equivalence has been shown, the execution can be stopped
     const auto* const checker = checkers.at(*completedID).get();
     const auto result = checker->getEquivalence();
 
+    // simulation tasks might account for more than a single simulation
+    const bool simulation = isSimulationChecker(checker);
+    std::size_t completedSimulations = 0U;
+    if (simulation) {
+      completedSimulations = simulationRuns[*completedID];
+      if (configuration.simulation.persistentWorkers) {
+        // persistent workers report all of their simulations at once
+        results.startedSimulations =
+            std::min(nextStimulus.load(), configuration.simulation.maxSims);
+        // the other workers have already claimed all stimuli
+        if (completedSimulations == 0U && !checker->aborted()) {
+          idleSlots.emplace_back(*completedID);
+          continue;
+        }
+      }
+    }
+
     if (result == EquivalenceCriterion::NoInformation) {
+      // a checker that exceeded its memory budget does not prevent the other
+      // checkers from reaching a conclusion
+      if (checker->aborted()) {
+        std::clog << "Equivalence checker aborted: "
+                  << checker->getAbortReason() << "\n";
+        if (simulation) {
+          // as in the sequential flow, no further simulations are started and
+          // the slot is handed to the other checkers (if enabled)
+          results.simulationsAborted = true;
+          // persistent workers report the simulations they performed before
+          // the aborted one
+          if (configuration.simulation.persistentWorkers &&
+              completedSimulations > 0U) {
+            results.performedSimulations += completedSimulations;
+            if (results.equivalence == EquivalenceCriterion::NoInformation) {
+              results.equivalence = EquivalenceCriterion::ProbablyEquivalent;
+            }
+          }
+          idleSlots.emplace_back(*completedID);
+          runningTasks += reassignIdleSlots();
+        }
+        continue;
+      }
       if (dynamic_cast<const ZXEquivalenceChecker*>(checker) != nullptr) {
         if (configuration.onlyZXCheckerConfigured()) {
           std::clog
@@ -708,25 +1033,26 @@ void EquivalenceCheckingManager::checkParallel() {
     if (result == EquivalenceCriterion::NotEquivalent) {
       setAndSignalDone();
       results.equivalence = result;
+      recordAlternatingWinner(*completedID);
 
       // some special handling in case non-equivalence has been shown by a
       // simulation run
-      if (const auto* const simulationChecker =
-              dynamic_cast<const DDSimulationChecker*>(checker)) {
-        ++results.performedSimulations;
-        results.cexInput = simulationChecker->getInitialState();
-        results.cexOutput1 = simulationChecker->getInternalState1();
-        results.cexOutput2 = simulationChecker->getInternalState2();
+      if (simulation) {
+        results.performedSimulations += completedSimulations;
+        setCounterexample(checker);
       }
       break;
     }
 
-    // the alternating and the construction checker provide definitive answers
-    // once they finish
+    // the alternating and the construction checker (as well as the splitting
+    // checker, which falls back to an alternating check) provide definitive
+    // answers once they finish
     if ((dynamic_cast<const DDAlternatingChecker*>(checker) != nullptr) ||
-        (dynamic_cast<const DDConstructionChecker*>(checker) != nullptr)) {
+        (dynamic_cast<const DDConstructionChecker*>(checker) != nullptr) ||
+        (dynamic_cast<const MiterSplittingChecker*>(checker) != nullptr)) {
       setAndSignalDone();
       results.equivalence = result;
+      recordAlternatingWinner(*completedID);
       break;
     }
 
@@ -769,8 +1095,8 @@ void EquivalenceCheckingManager::checkParallel() {
     }
 
     // at this point, the only option is that this is a simulation checker
-    if (dynamic_cast<const DDSimulationChecker*>(checker) != nullptr) {
-      ++results.performedSimulations;
+    if (simulation) {
+      results.performedSimulations += completedSimulations;
 
       // if no information is known, the successful simulation suggests that
       // both circuits are likely to be equivalent.
@@ -778,6 +1104,14 @@ void EquivalenceCheckingManager::checkParallel() {
         results.equivalence = EquivalenceCriterion::ProbablyEquivalent;
       }
 
+      idleSlots.emplace_back(*completedID);
+
+      if (adaptiveSimulations && simulationsFinished() &&
+          raiseSimulationLimit(start)) {
+        runningTasks += startPendingSimulations();
+        continue;
+      }
+
       if (simulationsFinished()) {
         if (configuration.onlySimulationCheckerConfigured()) {
           // if only simulations are performed and all of them are successful,
@@ -798,15 +1132,14 @@ void EquivalenceCheckingManager::checkParallel() {
         }
         // if all simulations finished and none of them showed non-equivalence,
         // the run continues uninterrupted.
+        runningTasks += reassignIdleSlots();
         continue;
       }
 
       // it has to be checked, whether further simulations shall be
       // conducted
-      if (results.startedSimulations < configuration.simulation.maxSims) {
-        futures[*completedID] =
-            asyncRunChecker<DDSimulationChecker>(*completedID, queue);
-        ++results.startedSimulations;
+      if (!configuration.simulation.persistentWorkers) {
+        runningTasks += startPendingSimulations();
       }
     }
   }
@@ -814,13 +1147,167 @@ void EquivalenceCheckingManager::checkParallel() {
   const auto end = std::chrono::steady_clock::now();
   results.checkTime = std::chrono::duration<double>(end - start).count();
 
-  // Futures are not explicitly waited for here, since the destructor of the
-  // `std::future` object will block until the associated thread has finished.
-  // If any thread is still stuck in a long-running operation, this might take a
-  // while, but the program will terminate anyway. C++20 introduces
-  // `std::jthread`, which allows to explicitly cancel a thread. This could be a
-  // solution for the future to avoid this problem (and reduce the number of
-  // `isDone` checks).
+  // Any tasks that are still running are cancelled and waited for by the
+  // `taskGuard` above. Checkers query their stop token in between individual
+  // decision diagram operations, so this should not take long. Tasks that are
+  // stuck in a single long-running operation for longer than the configured
+  // grace period are abandoned and only joined before the next run.
+}
+
+void EquivalenceCheckingManager::lendThreadPool(EquivalenceChecker& checker,
+                                                const std::size_t parallelism) {
+  const auto threads = std::min(parallelism, configuration.execution.nthreads);
+  if (threads <= 1U) {
+    return;
+  }
+  // the checker itself runs on the calling thread
+  const auto helpers = threads - 1U;
+  if (!threadPool || (ownsThreadPool && threadPool->size() < helpers)) {
+    threadPool = std::make_shared<ThreadPool>(helpers);
+    ownsThreadPool = true;
+  }
+  checker.setThreadPool(threadPool, helpers);
+}
+
+void EquivalenceCheckingManager::awaitTasks(
+    std::vector<std::future<void>>& tasks) {
+  const auto gracePeriod = configuration.execution.cancellationGracePeriod;
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration<double>(gracePeriod);
+  std::size_t abandoned = 0U;
+  for (std::size_t i = 0U; i < tasks.size(); ++i) {
+    auto& task = tasks[i];
+    if (!task.valid()) {
+      continue;
+    }
+    if (gracePeriod <= 0.) {
+      task.wait();
+    } else if (task.wait_until(deadline) != std::future_status::ready) {
+      abandonedTasks.emplace_back(i, std::move(task));
+      ++abandoned;
+    }
+  }
+  if (abandoned > 0U) {
+    std::clog << "[QCEC] Warning: " << abandoned
+              << " checker(s) did not stop within the cancellation grace "
+                 "period and have been abandoned.\n";
+  }
+}
+
+void EquivalenceCheckingManager::joinAbandonedTasks() {
+  for (auto& [slot, task] : abandonedTasks) {
+    // the results (and exceptions) of abandoned tasks are of no interest
+    task.wait();
+  }
+  abandonedTasks.clear();
+}
+
+bool EquivalenceCheckingManager::isAbandoned(const std::size_t slot) const {
+  return std::any_of(
+      abandonedTasks.begin(), abandonedTasks.end(),
+      [slot](const auto& abandoned) { return abandoned.first == slot; });
+}
+
+bool EquivalenceCheckingManager::isSimulationChecker(
+    const EquivalenceChecker* checker) {
+  return dynamic_cast<const DDSimulationChecker*>(checker) != nullptr ||
+         dynamic_cast<const DDBatchSimulationChecker*>(checker) != nullptr;
+}
+
+void EquivalenceCheckingManager::setCounterexample(
+    const EquivalenceChecker* checker) {
+  if (const auto* const simulationChecker =
+          dynamic_cast<const DDSimulationChecker*>(checker)) {
+    results.cexInput = simulationChecker->getInitialState();
+    results.cexOutput1 = simulationChecker->getInternalState1();
+    results.cexOutput2 = simulationChecker->getInternalState2();
+  } else if (const auto* const batchChecker =
+                 dynamic_cast<const DDBatchSimulationChecker*>(checker)) {
+    results.cexInput = batchChecker->getInitialState();
+    results.cexOutput1 = batchChecker->getInternalState1();
+    results.cexOutput2 = batchChecker->getInternalState2();
+  }
+}
+
+void EquivalenceCheckingManager::drawStimuli() {
+  const auto nqubits = std::max(qc1.getNqubits(), qc2.getNqubits());
+  const auto nancillary = nqubits - qc1.getNqubitsWithoutAncillae();
+  const auto stateType = configuration.simulation.stateType;
+
+  const std::lock_guard stateGeneratorLock(stateGeneratorMutex);
+  stimuli.clear();
+  stimuli.reserve(configuration.simulation.maxSims);
+  for (std::size_t i = 0U; i < configuration.simulation.maxSims; ++i) {
+    stimuli.emplace_back(
+        stateGenerator.drawRandomStimulus(nqubits, nancillary, stateType));
+  }
+  nextStimulus = 0U;
+}
+
+const EquivalenceChecker*
+EquivalenceCheckingManager::mostAdvancedAlternatingChecker() const {
+  const EquivalenceChecker* mostAdvanced = nullptr;
+  // the checkers keep progressing, so every progress is only queried once
+  double maxProgress = -1.;
+  for (const auto& slot : alternatingCheckers) {
+    const auto* const alternating = slot.load(std::memory_order_acquire);
+    if (alternating == nullptr) {
+      continue;
+    }
+    if (const auto progress = alternating->getProgress();
+        progress > maxProgress) {
+      maxProgress = progress;
+      mostAdvanced = alternating;
+    }
+  }
+  return mostAdvanced;
+}
+
+bool EquivalenceCheckingManager::raiseSimulationLimit(
+    const std::chrono::steady_clock::time_point start) {
+  const auto maxSims = configuration.simulation.maxSims;
+  const auto next = std::min(2U * simulationLimit, maxSims);
+  const auto elapsed = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+  // estimate the duration of the next round from the throughput so far
+  const auto roundTime = elapsed * static_cast<double>(next - simulationLimit) /
+                         static_cast<double>(results.performedSimulations);
+
+  nlohmann::json decision{};
+  decision["performed"] = results.performedSimulations;
+  decision["elapsed"] = elapsed;
+
+  std::string reason{};
+  if (simulationLimit >= maxSims) {
+    reason = "max_sims";
+  } else if (const auto timeout = configuration.execution.timeout;
+             timeout > 0. && elapsed + roundTime > timeout) {
+    reason = "timeout";
+  } else if (const auto* const alternating = mostAdvancedAlternatingChecker()) {
+    const auto progress = alternating->getProgress();
+    decision["alternating_progress"] = progress;
+    if (const auto* const dd =
+            dynamic_cast<const DDAlternatingChecker*>(alternating)) {
+      decision["alternating_nodes"] = dd->getActiveNodes();
+    }
+    // the alternating checker is expected to reach a definitive conclusion
+    // before the next round of simulations would be finished
+    if (progress > 0. && elapsed * (1. - progress) / progress < roundTime) {
+      reason = "alternating_progressing";
+    }
+  }
+
+  if (reason.empty()) {
+    simulationLimit = next;
+    decision["decision"] = "grow";
+  } else {
+    decision["decision"] = "stop";
+    decision["reason"] = reason;
+  }
+  decision["limit"] = simulationLimit;
+  results.simulationDecisions.emplace_back(decision);
+  return reason.empty();
 }
 
 void EquivalenceCheckingManager::checkSymbolic() {
@@ -848,6 +1335,8 @@ void EquivalenceCheckingManager::checkSymbolic() {
       checkers.emplace_back(
           std::make_unique<ZXEquivalenceChecker>(qc1, qc2, configuration));
       const auto& zxChecker = checkers.back();
+      lendThreadPool(*zxChecker,
+                     ZXEquivalenceChecker::parallelism(configuration));
       if (!done) {
         const auto result = zxChecker->run();
         results.equivalence = result;
@@ -882,6 +1371,15 @@ nlohmann::json EquivalenceCheckingManager::Results::json() const {
     auto& sim = res["simulations"];
     sim["started"] = startedSimulations;
     sim["performed"] = performedSimulations;
+    if (simulationsAborted) {
+      sim["aborted"] = true;
+    }
+    if (!simulationDecisions.empty()) {
+      sim["decisions"] = simulationDecisions;
+    }
+  }
+  if (!alternatingPortfolio.is_null()) {
+    res["alternating_portfolio"] = alternatingPortfolio;
   }
   auto& par = res["parameterized"];
   par["performed_instantiations"] = performedInstantiations;
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "NumericalToleranceLock.hpp"
+
+#include "dd/ComplexNumbers.hpp"
+#include "dd/DDDefinitions.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace ec {
+namespace {
+struct ToleranceState {
+  std::mutex mutex;
+  std::condition_variable cond;
+  dd::fp current{};
+  std::size_t holders = 0U;
+  // number of waiting checks per requested tolerance
+  std::map<dd::fp, std::size_t> waiting;
+  std::size_t totalWaiting = 0U;
+};
+
+ToleranceState& toleranceState() {
+  static ToleranceState state{};
+  return state;
+}
+} // namespace
+
+NumericalToleranceLock::NumericalToleranceLock(const dd::fp tolerance) {
+  auto& state = toleranceState();
+  std::unique_lock lock(state.mutex);
+  ++state.waiting[tolerance];
+  ++state.totalWaiting;
+  state.cond.wait(lock, [&state, tolerance] {
+    if (state.holders == 0U) {
+      return true;
+    }
+    // join the current holders unless someone waits for another tolerance
+    return state.current == tolerance &&
+           state.waiting[tolerance] == state.totalWaiting;
+  });
+  if (--state.waiting[tolerance] == 0U) {
+    state.waiting.erase(tolerance);
+  }
+  --state.totalWaiting;
+
+  if (state.holders == 0U) {
+    state.current = tolerance;
+    dd::ComplexNumbers::setTolerance(tolerance);
+    // other checks waiting for the same tolerance may join now
+    state.cond.notify_all();
+  }
+  ++state.holders;
+}
+
+NumericalToleranceLock::~NumericalToleranceLock() {
+  auto& state = toleranceState();
+  const std::lock_guard lock(state.mutex);
+  if (--state.holders == 0U) {
+    state.cond.notify_all();
+  }
+}
+} // namespace ec
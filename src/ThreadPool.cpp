@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace ec {
+ThreadPool::ThreadPool(const std::size_t nthreads) {
+  const auto nworkers = std::max(nthreads, static_cast<std::size_t>(1U));
+  queues.reserve(nworkers);
+  for (std::size_t i = 0U; i < nworkers; ++i) {
+    queues.emplace_back(std::make_unique<WorkQueue>());
+  }
+  workers.reserve(nworkers);
+  for (std::size_t i = 0U; i < nworkers; ++i) {
+    workers.emplace_back([this, i] { workerLoop(i); });
+  }
+}
+
+ThreadPool::ThreadPool()
+    : ThreadPool(static_cast<std::size_t>(std::thread::hardware_concurrency())) {
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    const std::lock_guard sleepLock(sleepMutex);
+    stopping = true;
+  }
+  sleepCond.notify_all();
+  for (auto& worker : workers) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+bool ThreadPool::popLocal(const std::size_t index,
+                          std::packaged_task<void()>& task) {
+  auto& queue = *queues[index];
+  const std::lock_guard queueLock(queue.mutex);
+  if (queue.tasks.empty()) {
+    return false;
+  }
+  task = std::move(queue.tasks.front());
+  queue.tasks.pop_front();
+  return true;
+}
+
+bool ThreadPool::steal(const std::size_t index,
+                       std::packaged_task<void()>& task) {
+  const auto nqueues = queues.size();
+  for (std::size_t offset = 1U; offset < nqueues; ++offset) {
+    auto& victim = *queues[(index + offset) % nqueues];
+    const std::lock_guard queueLock(victim.mutex);
+    if (victim.tasks.empty()) {
+      continue;
+    }
+    task = std::move(victim.tasks.back());
+    victim.tasks.pop_back();
+    return true;
+  }
+  return false;
+}
+
+void ThreadPool::workerLoop(const std::size_t index) {
+  while (true) {
+    std::packaged_task<void()> task{};
+    if (popLocal(index, task) || steal(index, task)) {
+      {
+        const std::lock_guard sleepLock(sleepMutex);
+        --pendingTasks;
+      }
+      // exceptions are captured in the shared state of the packaged task
+      task();
+      continue;
+    }
+
+    std::unique_lock sleepLock(sleepMutex);
+    sleepCond.wait(sleepLock, [this] { return stopping || pendingTasks > 0U; });
+    // remaining tasks are drained before the pool shuts down
+    if (stopping && pendingTasks == 0U) {
+      return;
+    }
+  }
+}
+} // namespace ec
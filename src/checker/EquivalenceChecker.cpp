@@ -20,4 +20,7 @@
 void ec::EquivalenceChecker::json(nlohmann::basic_json<>& j) const noexcept {
   j["equivalence"] = toString(equivalence);
   j["runtime"] = getRuntime();
+  if (aborted()) {
+    j["abort_reason"] = abortReason;
+  }
 }
@@ -13,11 +13,13 @@
 #include "EquivalenceCriterion.hpp"
 #include "checker/dd/DDEquivalenceChecker.hpp"
 #include "checker/dd/DDPackageConfigs.hpp"
+#include "checker/dd/GateCancellation.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/LookaheadApplicationScheme.hpp"
 #include "dd/Package.hpp"
 #include "ir/Definitions.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <nlohmann/json.hpp>
@@ -56,6 +58,23 @@ void DDAlternatingChecker::initialize() {
   // [1 0] (= |0><0|) for an ancillary only acted on in one circuit
   // [0 0]
   functionality = dd->reduceAncillae(functionality, ancillary);
+
+  if (const auto window = configuration.application.cancellationWindow;
+      window > 0U) {
+    // identical gates at the start of both circuits cancel as long as they do
+    // not act on any of the reduced ancillaries. Identical gates at the end of
+    // both circuits only cancel if the whole functionality is compared to the
+    // identity.
+    const auto hasAncillae =
+        std::find(ancillary.begin(), ancillary.end(), true) != ancillary.end();
+    const auto suffix =
+        !hasAncillae && !configuration.functionality.checkPartialEquivalence;
+    auto cancelled = cancelGates(*qc1, *qc2, window, ancillary, suffix);
+    cancelledPrefix = cancelled.prefix;
+    cancelledSuffix = cancelled.suffix;
+    taskManager1.setSkippedOperations(std::move(cancelled.first));
+    taskManager2.setSkippedOperations(std::move(cancelled.second));
+  }
 }
 
 void DDAlternatingChecker::execute() {
@@ -85,14 +104,28 @@ void DDAlternatingChecker::execute() {
       if (!isDone()) {
         taskManager2.advance(functionality, apply2);
       }
+      checkMemoryBudget();
+      recordProgress();
     }
   }
 }
 
 void DDAlternatingChecker::finish() {
-  taskManager1.finish(functionality);
-  if (!isDone()) {
-    taskManager2.finish(functionality);
+  // the states cached by the lookahead scheme are of no use for the remaining
+  // operations and would otherwise keep their nodes alive
+  if (auto* lookahead =
+          dynamic_cast<LookaheadApplicationScheme*>(applicationScheme.get())) {
+    lookahead->release();
+  }
+  while (!taskManager1.finished() && !isDone()) {
+    taskManager1.advance(functionality);
+    checkMemoryBudget();
+    recordProgress();
+  }
+  while (!taskManager2.finished() && !isDone()) {
+    taskManager2.advance(functionality);
+    checkMemoryBudget();
+    recordProgress();
   }
 }
 
@@ -188,12 +221,22 @@ DDAlternatingChecker::DDAlternatingChecker(const qc::QuantumComputation& circ1,
     // lookahead scheme
     lookahead->setInternalState(functionality);
     lookahead->setPackage(dd.get());
+    lookahead->setGarbageCollector(garbageCollector.get());
+    const auto& app = configuration.application;
+    lookahead->setSearch(app.lookaheadDepth, app.lookaheadBeamWidth,
+                         app.lookaheadSizeEstimate);
   }
 }
 
 void DDAlternatingChecker::json(nlohmann::basic_json<>& j) const noexcept {
   DDEquivalenceChecker::json(j);
   j["checker"] = "decision_diagram_alternating";
+  j["application_scheme"] =
+      toString(configuration.application.alternatingScheme);
+  if (configuration.application.cancellationWindow > 0U) {
+    j["cancelled_gates"] = {{"prefix", cancelledPrefix},
+                            {"suffix", cancelledSuffix}};
+  }
 }
 
 } // namespace ec
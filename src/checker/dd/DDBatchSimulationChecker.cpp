@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/DDBatchSimulationChecker.hpp"
+
+#include "Configuration.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/dd/DDEquivalenceChecker.hpp"
+#include "checker/dd/DDPackageConfigs.hpp"
+#include "checker/dd/TaskManager.hpp"
+#include "checker/dd/simulation/StateGenerator.hpp"
+#include "dd/Node.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include <utility>
+#include <vector>
+
+namespace ec {
+DDBatchSimulationChecker::DDBatchSimulationChecker(
+    const qc::QuantumComputation& circ1, const qc::QuantumComputation& circ2,
+    Configuration config)
+    : DDEquivalenceChecker(circ1, circ2, std::move(config),
+                           SimulationDDPackageConfig{}) {}
+
+void DDBatchSimulationChecker::setRandomInitialStates(
+    StateGenerator& generator, const std::size_t count) {
+  const auto nancillary = nqubits - qc1->getNqubitsWithoutAncillae();
+  const auto stateType = configuration.simulation.stateType;
+
+  initialStates.clear();
+  initialStates.reserve(count);
+  for (std::size_t i = 0U; i < count; ++i) {
+    initialStates.emplace_back(
+        generator.generateRandomState(*dd, nqubits, nancillary, stateType));
+  }
+}
+
+void DDBatchSimulationChecker::setInitialStates(
+    const std::vector<Stimulus>& stimuli) {
+  initialStates.clear();
+  initialStates.reserve(stimuli.size());
+  for (const auto& stimulus : stimuli) {
+    initialStates.emplace_back(StateGenerator::buildStimulus(*dd, stimulus));
+  }
+}
+
+void DDBatchSimulationChecker::simulate(TaskManager<dd::VectorDD>& task,
+                                        std::vector<dd::VectorDD>& states) {
+  task.reset();
+  task.applySwapOperations();
+  while (!task.finished() && !isDone()) {
+    task.applyGate(states);
+    task.applySwapOperations();
+    checkMemoryBudget();
+  }
+}
+
+void DDBatchSimulationChecker::postprocessStates(
+    TaskManager<dd::VectorDD>& task, std::vector<dd::VectorDD>& states) {
+  for (auto& state : states) {
+    if (isDone()) {
+      return;
+    }
+    // ensure that the permutation that was tracked throughout the circuit
+    // matches the expected output permutation
+    task.changePermutation(state);
+    // sum up the contributions of garbage qubits if we want to check for
+    // partial equivalence
+    if (configuration.functionality.checkPartialEquivalence) {
+      task.reduceGarbage(state);
+    }
+  }
+}
+
+void DDBatchSimulationChecker::releaseStates(
+    std::vector<dd::VectorDD>& states) {
+  for (auto& state : states) {
+    dd->decRef(state);
+  }
+}
+
+EquivalenceCriterion DDBatchSimulationChecker::run() {
+  const auto start = std::chrono::steady_clock::now();
+
+  equivalence = EquivalenceCriterion::NoInformation;
+
+  // both circuits start from the same batch of initial states
+  auto states1 = initialStates;
+  auto states2 = initialStates;
+  for (auto& state : states1) {
+    dd->incRef(state);
+  }
+  for (auto& state : states2) {
+    dd->incRef(state);
+  }
+
+  // since the direction has no effect on state vectors, each circuit can be
+  // simulated in its entirety without interleaving both circuits
+  simulate(taskManager1, states1);
+  simulate(taskManager2, states2);
+
+  postprocessStates(taskManager1, states1);
+  postprocessStates(taskManager2, states2);
+
+  if (!isDone()) {
+    equivalence = EquivalenceCriterion::Equivalent;
+    for (std::size_t i = 0U; i < initialStates.size(); ++i) {
+      const auto result = equals(states1[i], states2[i]);
+      if (result == EquivalenceCriterion::NotEquivalent) {
+        equivalence = result;
+        initialState = initialStates[i];
+        internalState1 = states1[i];
+        internalState2 = states2[i];
+        break;
+      }
+      if (result == EquivalenceCriterion::EquivalentUpToPhase) {
+        equivalence = result;
+      }
+    }
+
+    // determine maximum number of nodes used
+    maxActiveNodes = dd->vUniqueTable.getPeakNumActiveEntries();
+
+    const auto end = std::chrono::steady_clock::now();
+    runtime += std::chrono::duration<double>(end - start).count();
+  }
+
+  // adjust reference counts to facilitate reuse of the checker
+  releaseStates(states1);
+  releaseStates(states2);
+  releaseStates(initialStates);
+
+  return equivalence;
+}
+
+void DDBatchSimulationChecker::json(nlohmann::basic_json<>& j) const noexcept {
+  DDEquivalenceChecker::json(j);
+  j["checker"] = "decision_diagram_batch_simulation";
+  j["batch_size"] = initialStates.size();
+}
+
+} // namespace ec
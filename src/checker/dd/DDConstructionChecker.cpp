@@ -13,15 +13,176 @@
 #include "Configuration.hpp"
 #include "checker/dd/DDEquivalenceChecker.hpp"
 #include "checker/dd/DDPackageConfigs.hpp"
+#include "checker/dd/GarbageCollector.hpp"
 #include "checker/dd/TaskManager.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "dd/ComplexValue.hpp"
+#include "dd/DDpackageConfig.hpp"
 #include "dd/Node.hpp"
 #include "dd/Package.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <nlohmann/json.hpp>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+namespace {
+// the functionality of (a part of) a circuit together with the package it
+// lives in
+struct Segment {
+  std::unique_ptr<dd::Package> package;
+  dd::MatrixDD functionality;
+  // the configuration the package has been created with
+  dd::DDPackageConfig config;
+  // memory accounted to the package in the memory budget
+  std::size_t memory = 0U;
+};
+
+dd::MatrixDD
+importEdge(const dd::MatrixDD& e, dd::Package& target,
+           std::unordered_map<const dd::mNode*, dd::MatrixDD>& imported) {
+  if (e.w.exactlyZero()) {
+    return dd::MatrixDD::zero();
+  }
+  const auto weight = static_cast<dd::ComplexValue>(e.w);
+  if (e.isTerminal()) {
+    return dd::MatrixDD::terminal(target.cn.lookup(weight));
+  }
+  auto it = imported.find(e.p);
+  if (it == imported.end()) {
+    decltype(e.p->e) edges{};
+    for (std::size_t i = 0U; i < edges.size(); ++i) {
+      edges[i] = importEdge(e.p->e[i], target, imported);
+    }
+    it = imported.emplace(e.p, target.makeDDNode(e.p->v, edges)).first;
+  }
+  const auto& node = it->second;
+  if (node.w.exactlyZero()) {
+    return dd::MatrixDD::zero();
+  }
+  return {node.p,
+          target.cn.lookup(static_cast<dd::ComplexValue>(node.w) * weight)};
+}
+
+/// Rebuild a decision diagram from another package in the target package.
+/// Every node is only visited once. The source package must not be modified
+/// while the import is running.
+dd::MatrixDD importDD(const dd::MatrixDD& e, dd::Package& target) {
+  std::unordered_map<const dd::mNode*, dd::MatrixDD> imported{};
+  return importEdge(e, target, imported);
+}
+
+// memory budget shared by all packages of the segmented construction
+class SharedMemoryBudget {
+public:
+  /// \param mib The budget in MiB (0 means unlimited).
+  /// \param reserved The memory (in bytes) that is occupied anyway, e.g., by
+  /// the checker's own package.
+  SharedMemoryBudget(const std::size_t mib, const std::size_t reserved)
+      : limit(mib * 1024U * 1024U), used(reserved) {}
+
+  /// Update the memory accounted to the package of the segment and return
+  /// whether the budget is exceeded
+  bool update(Segment& segment) {
+    if (limit == 0U || exceeded()) {
+      return exceeded();
+    }
+    const auto estimate = [&segment] {
+      return ec::GarbageCollector::estimateMemory(*segment.package,
+                                                  segment.config);
+    };
+    if (account(segment, estimate()) > limit) {
+      // the budget might only be exceeded due to dead nodes
+      segment.package->garbageCollect(true);
+      if (account(segment, estimate()) > limit) {
+        overBudget.store(true, std::memory_order_relaxed);
+      }
+    }
+    return exceeded();
+  }
+
+  /// Release the memory accounted to the package of the segment
+  void release(Segment& segment) { account(segment, 0U); }
+
+  [[nodiscard]] bool exceeded() const noexcept {
+    return overBudget.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::size_t limit;
+  std::atomic<std::size_t> used;
+  std::atomic<bool> overBudget{false};
+
+  // returns the total memory accounted to all packages
+  std::size_t account(Segment& segment, const std::size_t memory) {
+    // unsigned arithmetic wraps around correctly if the memory shrinks
+    const auto delta = memory - segment.memory;
+    segment.memory = memory;
+    return used.fetch_add(delta, std::memory_order_relaxed) + delta;
+  }
+};
+
+// the packages of the segments only hold the functionality of a part of the
+// circuit. Hence, their tables are scaled to the size of the segment (but
+// never beyond the tables of the checker's package).
+dd::DDPackageConfig
+segmentPackageConfig(const dd::DDPackageConfig& config,
+                     const std::size_t nqubits, const std::size_t ops,
+                     ec::Configuration::Execution execution) {
+  execution.adaptiveTableSizing = true;
+  execution.uniqueTableBuckets = 0U;
+  execution.computeTableBuckets = 0U;
+  auto adapted = ec::adaptPackageConfig(config, true, nqubits, ops, execution);
+  if (adapted.utMatNumBucket >= config.utMatNumBucket) {
+    return config;
+  }
+  return adapted;
+}
+
+Segment constructSegment(const qc::QuantumComputation& qc,
+                         const std::size_t first, const std::size_t ops,
+                         const std::size_t nqubits,
+                         const dd::DDPackageConfig& packageConfig,
+                         SharedMemoryBudget& budget,
+                         const std::function<bool()>& cancelled) {
+  Segment segment{std::make_unique<dd::Package>(nqubits, packageConfig),
+                  dd::Package::makeIdent(), packageConfig};
+  ec::TaskManager<dd::MatrixDD> taskManager(qc, *segment.package);
+  taskManager.setCancellationHook(
+      [&] { return cancelled() || budget.update(segment); });
+  taskManager.incRef(segment.functionality);
+  if (first == 0U) {
+    // the ancillary qubits are only accounted for at the start of the circuit
+    taskManager.reduceAncillae(segment.functionality);
+  }
+  taskManager.skip(first);
+  taskManager.applyOperations(segment.functionality, ops);
+  return segment;
+}
+
+// replaces the functionality of `first` by the functionality of `second`
+// applied after `first`
+void combine(Segment& first, const Segment& second) {
+  auto& dd = *first.package;
+  const auto imported = importDD(second.functionality, dd);
+  dd.incRef(imported);
+  const auto product = dd.multiply(imported, first.functionality);
+  dd.incRef(product);
+  dd.decRef(imported);
+  dd.decRef(first.functionality);
+  first.functionality = product;
+  dd.garbageCollect();
+}
+} // namespace
 
 ec::DDConstructionChecker::DDConstructionChecker(
     const qc::QuantumComputation& circ1, const qc::QuantumComputation& circ2,
@@ -52,3 +213,107 @@ void ec::DDConstructionChecker::initializeTask(
   taskManager.incRef();
   taskManager.reduceAncillae();
 }
+
+std::size_t
+ec::DDConstructionChecker::parallelism(const Configuration& config) noexcept {
+  return 2U * std::max(config.execution.constructionSegments,
+                       static_cast<std::size_t>(1U));
+}
+
+void ec::DDConstructionChecker::execute() {
+  const auto maxSegments = configuration.execution.constructionSegments;
+  if (maxSegments <= 1U) {
+    DDEquivalenceChecker::execute();
+    return;
+  }
+
+  SharedMemoryBudget budget(
+      configuration.execution.memoryBudget,
+      GarbageCollector::estimateMemory(*dd, packageConfig));
+  const std::function<bool()> cancelled = [this, &budget] {
+    return isDone() || budget.exceeded();
+  };
+
+  // the functionalities of both circuits are constructed at the same time.
+  // Every task refers to a segment (or, later on, a pair of neighboring
+  // segments) of one of the circuits.
+  const std::array circuits{qc1, qc2};
+  std::array<std::vector<Segment>, 2U> parts{};
+  std::vector<std::pair<std::size_t, std::size_t>> tasks{};
+  for (std::size_t c = 0U; c < circuits.size(); ++c) {
+    const auto ops = circuits[c]->size();
+    parts[c].resize(
+        std::max(std::min(maxSegments, ops), static_cast<std::size_t>(1U)));
+    for (std::size_t k = 0U; k < parts[c].size(); ++k) {
+      tasks.emplace_back(c, k);
+    }
+  }
+
+  // construct the segments in worker-local packages
+  parallelFor(tasks.size(), [&](const std::size_t t) {
+    if (cancelled()) {
+      return;
+    }
+    const auto [c, k] = tasks[t];
+    const auto& qc = *circuits[c];
+    const auto segments = parts[c].size();
+    const auto first = k * qc.size() / segments;
+    const auto ops = ((k + 1U) * qc.size() / segments) - first;
+    parts[c][k] = constructSegment(
+        qc, first, ops, nqubits,
+        segmentPackageConfig(packageConfig, nqubits, ops,
+                             configuration.execution),
+        budget, cancelled);
+  });
+
+  // combine neighboring segments in a tree reduction. Every package is the
+  // target of at most one combination per level and is not read by any other
+  // combination in that level.
+  for (std::size_t stride = 1U; !cancelled(); stride *= 2U) {
+    tasks.clear();
+    for (std::size_t c = 0U; c < parts.size(); ++c) {
+      for (std::size_t i = 0U; i + stride < parts[c].size(); i += 2U * stride) {
+        tasks.emplace_back(c, i);
+      }
+    }
+    if (tasks.empty()) {
+      break;
+    }
+    parallelFor(tasks.size(), [&](const std::size_t t) {
+      if (cancelled()) {
+        return;
+      }
+      const auto [c, i] = tasks[t];
+      auto& target = parts[c][i];
+      auto& source = parts[c][i + stride];
+      combine(target, source);
+      budget.release(source);
+      source.package.reset();
+      budget.update(target);
+    });
+  }
+
+  if (budget.exceeded()) {
+    abortReason = "memory budget of " +
+                  std::to_string(configuration.execution.memoryBudget) +
+                  " MiB exceeded";
+    signalDone();
+  }
+  if (isDone()) {
+    return;
+  }
+
+  // move the results to the checker's package and mark both circuits as
+  // processed (while keeping track of the permutation)
+  const auto adopt = [this](TaskManager<dd::MatrixDD>& taskManager,
+                            const Segment& functionality) {
+    taskManager.decRef();
+    taskManager.setInternalState(importDD(functionality.functionality, *dd));
+    taskManager.incRef();
+    taskManager.skip(taskManager.getCircuit()->size());
+  };
+  adopt(taskManager1, parts[0].front());
+  adopt(taskManager2, parts[1].front());
+  checkMemoryBudget();
+  recordProgress();
+}
@@ -12,6 +12,8 @@
 
 #include "EquivalenceCriterion.hpp"
 #include "checker/EquivalenceChecker.hpp"
+#include "checker/dd/GarbageCollector.hpp"
+#include "checker/dd/GateCache.hpp"
 #include "checker/dd/TaskManager.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
@@ -22,8 +24,10 @@
 #include "dd/Node.hpp"
 
 #include <chrono>
+#include <cstddef>
 #include <nlohmann/json.hpp>
 #include <stdexcept>
+#include <string>
 
 namespace ec {
 
@@ -171,16 +175,55 @@ template <class DDType> void DDEquivalenceChecker<DDType>::execute() {
       if (!isDone()) {
         taskManager2.advance(apply2);
       }
+      checkMemoryBudget();
+      recordProgress();
     }
   }
 }
 
 template <class DDType> void DDEquivalenceChecker<DDType>::finish() {
-  if (!isDone()) {
-    taskManager1.finish();
+  while (!taskManager1.finished() && !isDone()) {
+    taskManager1.advance();
+    checkMemoryBudget();
+    recordProgress();
   }
-  if (!isDone()) {
-    taskManager2.finish();
+  while (!taskManager2.finished() && !isDone()) {
+    taskManager2.advance();
+    checkMemoryBudget();
+    recordProgress();
+  }
+}
+
+template <class DDType>
+void DDEquivalenceChecker<DDType>::checkMemoryBudget() {
+  const auto budget = configuration.execution.memoryBudget;
+  if (budget == 0U) {
+    return;
+  }
+  const std::size_t maxMemory = budget * 1024U * 1024U;
+  if (GarbageCollector::estimateMemory(*dd, packageConfig) <= maxMemory) {
+    return;
+  }
+  // the budget might only be exceeded due to dead nodes
+  dd->garbageCollect(true);
+  if (GarbageCollector::estimateMemory(*dd, packageConfig) <= maxMemory) {
+    return;
+  }
+  abortReason = "memory budget of " + std::to_string(budget) + " MiB exceeded";
+  signalDone();
+}
+
+template <class DDType> void DDEquivalenceChecker<DDType>::recordProgress() {
+  const auto applied = (taskManager1.getIterator() - qc1->begin()) +
+                       (taskManager2.getIterator() - qc2->begin());
+  appliedGates.store(static_cast<std::size_t>(applied),
+                     std::memory_order_relaxed);
+  if constexpr (std::is_same_v<DDType, dd::MatrixDD>) {
+    activeNodes.store(dd->mUniqueTable.getNumActiveEntries(),
+                      std::memory_order_relaxed);
+  } else {
+    activeNodes.store(dd->vUniqueTable.getNumActiveEntries(),
+                      std::memory_order_relaxed);
   }
 }
 
@@ -265,6 +308,17 @@ void DDEquivalenceChecker<DDType>::json(
     nlohmann::basic_json<>& j) const noexcept {
   EquivalenceChecker::json(j);
   j["max_nodes"] = maxActiveNodes;
+  if constexpr (std::is_same_v<DDType, dd::MatrixDD>) {
+    j["unique_table_buckets"] = packageConfig.utMatNumBucket;
+  } else {
+    j["unique_table_buckets"] = packageConfig.utVecNumBucket;
+  }
+  if (gateCache) {
+    gateCache->json(j["gate_cache"]);
+  }
+  if (garbageCollector) {
+    garbageCollector->json(j["garbage_collection"]);
+  }
 }
 
 template class DDEquivalenceChecker<dd::VectorDD>;
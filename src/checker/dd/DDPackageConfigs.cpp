@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/DDPackageConfigs.hpp"
+
+#include "Configuration.hpp"
+#include "dd/DDpackageConfig.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace ec {
+namespace {
+// bounds for the number of buckets of the primary unique table chosen by the
+// adaptive sizing
+constexpr std::size_t MIN_PRIMARY_BUCKETS = 1'024U;
+constexpr std::size_t MAX_PRIMARY_BUCKETS = 262'144U;
+// scaled down tables never shrink below this size (unless they started out
+// smaller)
+constexpr std::size_t MIN_BUCKETS = 64U;
+
+std::size_t log2Ceil(std::size_t value) noexcept {
+  std::size_t log = 0U;
+  while ((static_cast<std::size_t>(1U) << log) < value) {
+    ++log;
+  }
+  return log;
+}
+
+// number of powers of two by which `target` exceeds `reference` (negative if
+// it is smaller)
+int powerOfTwoShift(const std::size_t target, const std::size_t reference) {
+  return static_cast<int>(log2Ceil(target)) -
+         static_cast<int>(log2Ceil(reference));
+}
+
+void scale(std::size_t& buckets, const int shift) noexcept {
+  // disabled tables stay disabled
+  if (buckets <= 1U || shift == 0) {
+    return;
+  }
+  if (shift > 0) {
+    buckets <<= static_cast<std::size_t>(shift);
+  } else {
+    buckets = std::max(buckets >> static_cast<std::size_t>(-shift),
+                       std::min(buckets, MIN_BUCKETS));
+  }
+}
+} // namespace
+
+dd::DDPackageConfig
+adaptPackageConfig(const dd::DDPackageConfig& config, const bool matrices,
+                   const std::size_t nqubits, const std::size_t ngates,
+                   const Configuration::Execution& execution) {
+  // the checker-specific tables are part of the opt-in. Otherwise, all
+  // checkers keep the default tables of the package.
+  auto adapted = execution.adaptiveTableSizing ? config : dd::DDPackageConfig{};
+  const auto primaryUnique =
+      matrices ? adapted.utMatNumBucket : adapted.utVecNumBucket;
+  const auto primaryCompute =
+      matrices ? adapted.ctMatMatMultNumBucket : adapted.ctMatVecMultNumBucket;
+
+  int uniqueShift = 0;
+  if (execution.uniqueTableBuckets > 0U) {
+    uniqueShift = powerOfTwoShift(execution.uniqueTableBuckets, primaryUnique);
+  } else if (execution.adaptiveTableSizing) {
+    // every gate contributes about one node per qubit to the intermediate
+    // decision diagrams
+    auto expectedNodes = MAX_PRIMARY_BUCKETS;
+    if (nqubits == 0U || ngates <= MAX_PRIMARY_BUCKETS / nqubits) {
+      expectedNodes = std::max(nqubits * ngates, MIN_PRIMARY_BUCKETS);
+    }
+    uniqueShift = powerOfTwoShift(expectedNodes, primaryUnique);
+  }
+
+  int computeShift = uniqueShift;
+  if (execution.computeTableBuckets > 0U) {
+    computeShift =
+        powerOfTwoShift(execution.computeTableBuckets, primaryCompute);
+  }
+
+  if (matrices) {
+    scale(adapted.utMatNumBucket, uniqueShift);
+    scale(adapted.utMatInitialAllocationSize, uniqueShift);
+    scale(adapted.ctMatAddNumBucket, computeShift);
+    scale(adapted.ctMatAddMagNumBucket, computeShift);
+    scale(adapted.ctMatConjTransNumBucket, computeShift);
+    scale(adapted.ctMatMatMultNumBucket, computeShift);
+    scale(adapted.ctMatKronNumBucket, computeShift);
+    scale(adapted.ctMatTraceNumBucket, computeShift);
+  } else {
+    scale(adapted.utVecNumBucket, uniqueShift);
+    scale(adapted.utVecInitialAllocationSize, uniqueShift);
+    scale(adapted.ctVecAddNumBucket, computeShift);
+    scale(adapted.ctVecAddMagNumBucket, computeShift);
+    scale(adapted.ctVecConjNumBucket, computeShift);
+    scale(adapted.ctMatVecMultNumBucket, computeShift);
+    scale(adapted.ctVecKronNumBucket, computeShift);
+    scale(adapted.ctVecInnerProdNumBucket, computeShift);
+  }
+  return adapted;
+}
+} // namespace ec
@@ -57,6 +57,10 @@ void DDSimulationChecker::setRandomInitialState(StateGenerator& generator) {
       generator.generateRandomState(*dd, nqubits, nancillary, stateType);
 }
 
+void DDSimulationChecker::setInitialState(const Stimulus& stimulus) {
+  initialState = StateGenerator::buildStimulus(*dd, stimulus);
+}
+
 void DDSimulationChecker::json(nlohmann::basic_json<>& j) const noexcept {
   DDEquivalenceChecker::json(j);
   j["checker"] = "decision_diagram_simulation";
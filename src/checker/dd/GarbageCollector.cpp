@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/GarbageCollector.hpp"
+
+#include "checker/dd/GarbageCollectionPolicy.hpp"
+#include "dd/DDpackageConfig.hpp"
+#include "dd/Node.hpp"
+#include "dd/Package.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <nlohmann/json.hpp>
+
+namespace ec {
+GarbageCollector::GarbageCollector(dd::Package& dd,
+                                   const GarbageCollectionPolicy gcPolicy,
+                                   const std::size_t gcInterval,
+                                   const double loadFactor,
+                                   const std::size_t highWaterMark,
+                                   const dd::DDPackageConfig& packageConfig)
+    : package(&dd), policy(gcPolicy),
+      interval(std::max(gcInterval, static_cast<std::size_t>(1U))),
+      maxEntries(static_cast<std::size_t>(
+          loadFactor * static_cast<double>(packageConfig.utMatNumBucket +
+                                           packageConfig.utVecNumBucket))),
+      maxMemory(highWaterMark * 1024U * 1024U),
+      computeTables(computeTableMemory(packageConfig)) {
+  if (policy == GarbageCollectionPolicy::Adaptive) {
+    // start out collecting frequently and back off if collections do not pay
+    interval = 1U;
+  }
+}
+
+std::size_t GarbageCollector::numEntries(const dd::Package& dd) {
+  return dd.mUniqueTable.getNumEntries() + dd.vUniqueTable.getNumEntries();
+}
+
+std::size_t GarbageCollector::nodeMemory(const dd::Package& dd) {
+  return (dd.mUniqueTable.getNumEntries() * sizeof(dd::mNode)) +
+         (dd.vUniqueTable.getNumEntries() * sizeof(dd::vNode));
+}
+
+std::size_t
+GarbageCollector::computeTableMemory(const dd::DDPackageConfig& config) {
+  // every entry holds (at most) two operands and a result
+  constexpr auto matrixEntry = 3U * sizeof(dd::mEdge);
+  constexpr auto vectorEntry = 3U * sizeof(dd::vEdge);
+  const auto matrixBuckets =
+      config.ctMatAddNumBucket + config.ctMatAddMagNumBucket +
+      config.ctMatConjTransNumBucket + config.ctMatMatMultNumBucket +
+      config.ctMatKronNumBucket + config.ctMatTraceNumBucket;
+  const auto vectorBuckets =
+      config.ctVecAddNumBucket + config.ctVecAddMagNumBucket +
+      config.ctVecConjNumBucket + config.ctMatVecMultNumBucket +
+      config.ctVecKronNumBucket + config.ctVecInnerProdNumBucket;
+  return (matrixBuckets * matrixEntry) + (vectorBuckets * vectorEntry);
+}
+
+bool GarbageCollector::collect(const bool force) {
+  gatesSinceCollection = 0U;
+  ++invocations;
+  if (package->garbageCollect(force)) {
+    ++collections;
+    return true;
+  }
+  return false;
+}
+
+void GarbageCollector::operator()() {
+  // apart from the default policy, collections are forced since the package
+  // would otherwise defer to its own threshold (which small checks never reach)
+  switch (policy) {
+  case GarbageCollectionPolicy::Periodic:
+    if (++gatesSinceCollection >= interval) {
+      collect(true);
+    }
+    break;
+  case GarbageCollectionPolicy::LoadFactor:
+    if (const auto entries = numEntries(*package);
+        entries > std::max(maxEntries, 2U * survivorsEntries)) {
+      collect(true);
+      survivorsEntries = numEntries(*package);
+    }
+    break;
+  case GarbageCollectionPolicy::HighWaterMark:
+    // the compute tables do not shrink by collecting garbage, so only the
+    // memory of the nodes has to double before collecting again
+    if (const auto memory = nodeMemory(*package) + computeTables;
+        memory > std::max(maxMemory, computeTables + (2U * survivorsMemory))) {
+      collect(true);
+      survivorsMemory = nodeMemory(*package);
+    }
+    break;
+  case GarbageCollectionPolicy::Adaptive:
+    if (++gatesSinceCollection >= interval) {
+      const auto before = numEntries(*package);
+      if (collect(true) && before > 0U) {
+        const auto after = numEntries(*package);
+        const auto yield = static_cast<double>(before - std::min(before, after)) /
+                           static_cast<double>(before);
+        // collections that free little memory are done less often and vice
+        // versa
+        if (yield < ADAPTIVE_LOW_YIELD) {
+          interval = std::min(2U * interval, ADAPTIVE_MAX_INTERVAL);
+        } else if (yield > ADAPTIVE_HIGH_YIELD) {
+          interval = std::max(interval / 2U, static_cast<std::size_t>(1U));
+        }
+      }
+    }
+    break;
+  default:
+    collect(false);
+    break;
+  }
+}
+
+void GarbageCollector::json(nlohmann::json& j) const {
+  j["policy"] = toString(policy);
+  j["invocations"] = invocations;
+  j["collections"] = collections;
+  if (policy == GarbageCollectionPolicy::Periodic ||
+      policy == GarbageCollectionPolicy::Adaptive) {
+    j["interval"] = interval;
+  }
+}
+} // namespace ec
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/GateCache.hpp"
+
+#include "dd/Node.hpp"
+#include "dd/Operations.hpp"
+#include "dd/Package.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/Permutation.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <nlohmann/json.hpp>
+
+namespace ec {
+namespace {
+void hashCombine(std::size_t& seed, const std::size_t value) noexcept {
+  // NOLINTNEXTLINE(readability-magic-numbers)
+  seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6U) + (seed >> 2U);
+}
+} // namespace
+
+std::size_t GateCache::KeyHash::operator()(const Key& key) const noexcept {
+  auto seed = static_cast<std::size_t>(key.type);
+  hashCombine(seed, static_cast<std::size_t>(key.inverse));
+  for (const auto& parameter : key.parameters) {
+    hashCombine(seed, std::hash<qc::fp>{}(parameter));
+  }
+  for (const auto& target : key.targets) {
+    hashCombine(seed, target);
+  }
+  for (const auto& control : key.controls) {
+    hashCombine(seed, control.qubit);
+    hashCombine(seed, static_cast<std::size_t>(control.type));
+  }
+  return seed;
+}
+
+GateCache::GateCache(dd::Package& dd, const std::size_t maxEntries)
+    : package(&dd), capacity(maxEntries) {}
+
+GateCache::~GateCache() { clear(); }
+
+dd::MatrixDD GateCache::get(const qc::Operation& op,
+                            qc::Permutation& permutation, const bool inverse) {
+  // operations other than standard operations are not worth caching.
+  // Uncontrolled SWAP operations are handled by adjusting the permutation.
+  if (capacity == 0U || !op.isStandardOperation() ||
+      (op.getType() == qc::SWAP && !op.isControlled())) {
+    return inverse ? dd::getInverseDD(op, *package, permutation)
+                   : dd::getDD(op, *package, permutation);
+  }
+
+  Key key{op.getType(), inverse, op.getParameter(),
+          permutation.apply(op.getTargets()),
+          permutation.apply(op.getControls())};
+
+  if (const auto it = lookup.find(key); it != lookup.end()) {
+    ++hits;
+    // mark the entry as most recently used
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->second;
+  }
+
+  ++misses;
+  auto gate = inverse ? dd::getInverseDD(op, *package, permutation)
+                      : dd::getDD(op, *package, permutation);
+
+  // evict the least recently used entry if the cache is full
+  if (entries.size() >= capacity) {
+    auto& last = entries.back();
+    package->decRef(last.second);
+    lookup.erase(last.first);
+    entries.pop_back();
+    ++evictions;
+  }
+
+  // pin the gate so that it survives garbage collection
+  package->incRef(gate);
+  entries.emplace_front(std::move(key), gate);
+  lookup.emplace(entries.front().first, entries.begin());
+  return gate;
+}
+
+void GateCache::clear() {
+  for (auto& [key, gate] : entries) {
+    package->decRef(gate);
+  }
+  entries.clear();
+  lookup.clear();
+}
+
+void GateCache::json(nlohmann::json& j) const {
+  j["capacity"] = capacity;
+  j["size"] = entries.size();
+  j["hits"] = hits;
+  j["misses"] = misses;
+  j["evictions"] = evictions;
+}
+} // namespace ec
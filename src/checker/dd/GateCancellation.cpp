@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/GateCancellation.hpp"
+
+#include "ir/Definitions.hpp"
+#include "ir/Permutation.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ec {
+namespace {
+using Operations = std::vector<const qc::Operation*>;
+
+Operations operations(const qc::QuantumComputation& qc) {
+  Operations ops{};
+  ops.reserve(qc.size());
+  for (const auto& op : qc) {
+    ops.emplace_back(op.get());
+  }
+  return ops;
+}
+
+bool isElidedSwap(const qc::Operation& op) {
+  return op.getType() == qc::SWAP && !op.isControlled();
+}
+
+// the permutation tracked by a task manager at the end of the circuit
+qc::Permutation finalPermutation(const qc::QuantumComputation& qc) {
+  auto permutation = qc.initialLayout;
+  for (const auto& op : qc) {
+    if (isElidedSwap(*op)) {
+      const auto& targets = op->getTargets();
+      std::swap(permutation.at(targets[0]), permutation.at(targets[1]));
+    }
+  }
+  return permutation;
+}
+
+bool isBlocked(const qc::Qubit physical, const qc::Permutation& permutation,
+               const std::vector<bool>& blocked) {
+  const auto it = permutation.find(physical);
+  if (it == permutation.end()) {
+    return false;
+  }
+  const auto logical = static_cast<std::size_t>(it->second);
+  return logical < blocked.size() && blocked[logical];
+}
+
+/**
+ * The dependency graph of a circuit that is consumed from one of its ends.
+ * For every qubit, the (remaining) operations acting on it are kept in the
+ * order in which they are consumed. An operation is on the frontier of the
+ * graph if it is the next operation on all of its qubits.
+ */
+class Frontier {
+public:
+  Frontier(const Operations& ops, const std::size_t nqubits,
+           const bool reverse, const qc::Permutation& permutation,
+           const std::vector<bool>& blocked, std::vector<bool>& cancelled)
+      : removed(&cancelled), qubits(ops.size()), cancellable(ops.size()),
+        perQubit(nqubits), heads(nqubits) {
+    order.reserve(ops.size());
+    for (std::size_t i = 0U; i < ops.size(); ++i) {
+      const auto idx = reverse ? ops.size() - 1U - i : i;
+      if (cancelled[idx]) {
+        continue;
+      }
+      order.emplace_back(idx);
+      const auto& op = *ops[idx];
+      bool canCancel = op.isUnitary() && op.getType() != qc::Barrier &&
+                       !isElidedSwap(op);
+      for (const auto q : op.getUsedQubits()) {
+        qubits[idx].emplace_back(q);
+        perQubit.at(q).emplace_back(idx);
+        canCancel = canCancel && !isBlocked(q, permutation, blocked);
+      }
+      cancellable[idx] = canCancel;
+    }
+  }
+
+  /// Returns the cancellable operations on the frontier among the first
+  /// `window` remaining operations
+  [[nodiscard]] std::vector<std::size_t> frontier(const std::size_t window) {
+    while (first < order.size() && (*removed)[order[first]]) {
+      ++first;
+    }
+    std::vector<std::size_t> result{};
+    std::size_t considered = 0U;
+    for (auto pos = first; pos < order.size() && considered < window; ++pos) {
+      const auto idx = order[pos];
+      if ((*removed)[idx]) {
+        continue;
+      }
+      ++considered;
+      if (cancellable[idx] && isFront(idx)) {
+        result.emplace_back(idx);
+      }
+    }
+    return result;
+  }
+
+  /// Remove an operation on the frontier from the graph
+  void remove(const std::size_t idx) {
+    (*removed)[idx] = true;
+    for (const auto q : qubits[idx]) {
+      ++heads[q];
+    }
+  }
+
+private:
+  std::vector<bool>* removed;
+  std::vector<std::size_t> order;
+  std::size_t first = 0U;
+
+  std::vector<std::vector<qc::Qubit>> qubits;
+  std::vector<bool> cancellable;
+  std::vector<std::vector<std::size_t>> perQubit;
+  std::vector<std::size_t> heads;
+
+  [[nodiscard]] bool isFront(const std::size_t idx) const {
+    for (const auto q : qubits[idx]) {
+      if (perQubit[q][heads[q]] != idx) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+std::size_t cancel(Frontier& frontier1, Frontier& frontier2,
+                   const Operations& ops1, const Operations& ops2,
+                   const std::size_t window, const qc::Permutation& perm1,
+                   const qc::Permutation& perm2) {
+  std::size_t pairs = 0U;
+  bool found = true;
+  while (found) {
+    found = false;
+    // removing an operation from the frontier does not affect the other
+    // operations on the frontier, so that all matches can be removed at once
+    const auto front1 = frontier1.frontier(window);
+    auto front2 = frontier2.frontier(window);
+    for (const auto i : front1) {
+      for (auto& j : front2) {
+        if (j < ops2.size() && ops1[i]->equals(*ops2[j], perm1, perm2)) {
+          frontier1.remove(i);
+          frontier2.remove(j);
+          // mark the operation as matched
+          j = ops2.size();
+          ++pairs;
+          found = true;
+          break;
+        }
+      }
+    }
+  }
+  return pairs;
+}
+} // namespace
+
+CancelledGates cancelGates(const qc::QuantumComputation& qc1,
+                           const qc::QuantumComputation& qc2,
+                           const std::size_t window,
+                           const std::vector<bool>& blocked,
+                           const bool suffix) {
+  CancelledGates result{std::vector<bool>(qc1.size()),
+                        std::vector<bool>(qc2.size())};
+  if (window == 0U) {
+    return result;
+  }
+
+  const auto ops1 = operations(qc1);
+  const auto ops2 = operations(qc2);
+  {
+    Frontier frontier1(ops1, qc1.getNqubits(), false, qc1.initialLayout,
+                       blocked, result.first);
+    Frontier frontier2(ops2, qc2.getNqubits(), false, qc2.initialLayout,
+                       blocked, result.second);
+    result.prefix = cancel(frontier1, frontier2, ops1, ops2, window,
+                           qc1.initialLayout, qc2.initialLayout);
+  }
+
+  if (!suffix) {
+    return result;
+  }
+  // gates at the end of the circuits only cancel if they are followed by the
+  // same permutation in both circuits
+  const auto perm1 = finalPermutation(qc1);
+  const auto perm2 = finalPermutation(qc2);
+  if (perm1 != perm2 || qc1.outputPermutation != qc2.outputPermutation) {
+    return result;
+  }
+  Frontier frontier1(ops1, qc1.getNqubits(), true, perm1, blocked,
+                     result.first);
+  Frontier frontier2(ops2, qc2.getNqubits(), true, perm2, blocked,
+                     result.second);
+  result.suffix =
+      cancel(frontier1, frontier2, ops1, ops2, window, perm1, perm2);
+  return result;
+}
+} // namespace ec
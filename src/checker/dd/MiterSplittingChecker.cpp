@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/MiterSplittingChecker.hpp"
+
+#include "Configuration.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "StopToken.hpp"
+#include "checker/EquivalenceChecker.hpp"
+#include "checker/dd/DDAlternatingChecker.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <nlohmann/json.hpp>
+#include <utility>
+#include <vector>
+
+namespace ec {
+namespace {
+std::vector<const qc::Operation*>
+operations(const qc::QuantumComputation& qc) {
+  std::vector<const qc::Operation*> ops{};
+  ops.reserve(qc.size());
+  for (const auto& op : qc) {
+    ops.emplace_back(op.get());
+  }
+  return ops;
+}
+
+qc::QuantumComputation extract(const qc::QuantumComputation& qc,
+                               const std::size_t begin,
+                               const std::size_t end) {
+  qc::QuantumComputation sub(qc.getNqubits());
+  const auto first = std::next(qc.begin(), static_cast<std::ptrdiff_t>(begin));
+  const auto last = std::next(qc.begin(), static_cast<std::ptrdiff_t>(end));
+  for (auto it = first; it != last; ++it) {
+    sub.emplace_back((*it)->clone());
+  }
+  return sub;
+}
+
+bool isEquivalent(const EquivalenceCriterion criterion) {
+  return criterion == EquivalenceCriterion::Equivalent ||
+         criterion == EquivalenceCriterion::EquivalentUpToGlobalPhase;
+}
+} // namespace
+
+bool MiterSplittingChecker::canSplit(const qc::QuantumComputation& qc1,
+                                     const qc::QuantumComputation& qc2,
+                                     const Configuration& config) {
+  // conjugating a reduced matrix by the identical parts of the circuits does
+  // not preserve its closeness to the identity
+  if (config.functionality.checkPartialEquivalence ||
+      qc1.getNancillae() != 0U || qc2.getNancillae() != 0U) {
+    return false;
+  }
+  if (qc1.getNqubits() != qc2.getNqubits() ||
+      qc1.initialLayout != qc2.initialLayout ||
+      qc1.outputPermutation != qc2.outputPermutation) {
+    return false;
+  }
+  const auto isUnitary = [](const auto& op) { return op->isUnitary(); };
+  return std::all_of(qc1.begin(), qc1.end(), isUnitary) &&
+         std::all_of(qc2.begin(), qc2.end(), isUnitary);
+}
+
+std::vector<MiterSplittingChecker::Region>
+MiterSplittingChecker::split(const qc::QuantumComputation& qc1,
+                             const qc::QuantumComputation& qc2) {
+  const auto ops1 = operations(qc1);
+  const auto ops2 = operations(qc2);
+  const auto n1 = ops1.size();
+  const auto n2 = ops2.size();
+
+  const auto identical = [&](const std::size_t i, const std::size_t j) {
+    return ops1[i]->equals(*ops2[j]);
+  };
+  const auto synchronized = [&](const std::size_t i, const std::size_t j) {
+    if (i + SYNC_LENGTH > n1 || j + SYNC_LENGTH > n2) {
+      return false;
+    }
+    for (std::size_t k = 0U; k < SYNC_LENGTH; ++k) {
+      if (!identical(i + k, j + k)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  std::vector<Region> regions{};
+  std::size_t i = 0U;
+  std::size_t j = 0U;
+  while (i < n1 && j < n2) {
+    if (identical(i, j)) {
+      ++i;
+      ++j;
+      continue;
+    }
+    // search for the closest synchronization point. Without one, the region
+    // extends to the end of both circuits.
+    auto syncI = n1;
+    auto syncJ = n2;
+    bool found = false;
+    for (std::size_t distance = 1U; distance <= SYNC_DISTANCE && !found;
+         ++distance) {
+      for (std::size_t di = 0U; di <= distance; ++di) {
+        if (synchronized(i + di, j + distance - di)) {
+          syncI = i + di;
+          syncJ = j + distance - di;
+          found = true;
+          break;
+        }
+      }
+    }
+    regions.emplace_back(Region{i, syncI, j, syncJ});
+    i = syncI;
+    j = syncJ;
+  }
+  if (i < n1 || j < n2) {
+    regions.emplace_back(Region{i, n1, j, n2});
+  }
+  return regions;
+}
+
+EquivalenceCriterion
+MiterSplittingChecker::checkSubMiters(const std::vector<Region>& regions) {
+  if (regions.empty()) {
+    return EquivalenceCriterion::Equivalent;
+  }
+
+  std::vector<std::pair<qc::QuantumComputation, qc::QuantumComputation>>
+      miters{};
+  miters.reserve(regions.size());
+  std::size_t unresolved = 0U;
+  for (const auto& region : regions) {
+    miters.emplace_back(extract(*qc1, region.begin1, region.end1),
+                        extract(*qc2, region.begin2, region.end2));
+    const auto& [sub1, sub2] = miters.back();
+    maxSubMiterSize = std::max(maxSubMiterSize, sub1.size() + sub2.size());
+    unresolved += sub1.size() + sub2.size();
+  }
+  // the operations in between the regions are identical in both circuits
+  resolvedOperations.store(qc1->size() + qc2->size() - unresolved,
+                           std::memory_order_relaxed);
+
+  // the sub-miters are distributed dynamically over the thread the checker
+  // is run on and its helper threads. As soon as one of them is not shown to
+  // be equivalent, the remaining ones are pointless.
+  std::vector<EquivalenceCriterion> results(
+      miters.size(), EquivalenceCriterion::NoInformation);
+  auto stop = linkedStopSource();
+  parallelFor(miters.size(), [&](const std::size_t k) {
+    if (stop.stopRequested()) {
+      return;
+    }
+    DDAlternatingChecker checker(miters[k].first, miters[k].second,
+                                 configuration);
+    checker.setStopToken(stop.getToken());
+    try {
+      results[k] = checker.run();
+    } catch (...) {
+      stop.requestStop();
+      throw;
+    }
+    if (!isEquivalent(results[k])) {
+      stop.requestStop();
+      return;
+    }
+    resolvedOperations.fetch_add(miters[k].first.size() +
+                                     miters[k].second.size(),
+                                 std::memory_order_relaxed);
+  });
+
+  checkedSubMiters = static_cast<std::size_t>(
+      std::count_if(results.begin(), results.end(), isEquivalent));
+  if (checkedSubMiters != results.size()) {
+    return EquivalenceCriterion::NoInformation;
+  }
+  if (std::all_of(results.begin(), results.end(), [](const auto result) {
+        return result == EquivalenceCriterion::Equivalent;
+      })) {
+    return EquivalenceCriterion::Equivalent;
+  }
+  // the global phases of the sub-miters might cancel, but this is not tracked
+  return EquivalenceCriterion::EquivalentUpToGlobalPhase;
+}
+
+EquivalenceCriterion MiterSplittingChecker::checkWhole() {
+  DDAlternatingChecker checker(*qc1, *qc2, configuration);
+  checker.setStopToken(linkedStopSource().getToken());
+  const auto result = checker.run();
+  if (checker.aborted()) {
+    abortReason = checker.getAbortReason();
+  }
+  return result;
+}
+
+EquivalenceCriterion MiterSplittingChecker::run() {
+  const auto start = std::chrono::steady_clock::now();
+
+  if (canSplit(*qc1, *qc2, configuration)) {
+    const auto regions = split(*qc1, *qc2);
+    subMiters = regions.size();
+    equivalence = checkSubMiters(regions);
+  }
+  if (equivalence == EquivalenceCriterion::NoInformation && !isDone()) {
+    fallback = true;
+    resolvedOperations.store(0U, std::memory_order_relaxed);
+    equivalence = checkWhole();
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  runtime += std::chrono::duration<double>(end - start).count();
+  return equivalence;
+}
+
+double MiterSplittingChecker::getProgress() const noexcept {
+  const auto total = qc1->size() + qc2->size();
+  if (total == 0U) {
+    return 1.;
+  }
+  return static_cast<double>(
+             resolvedOperations.load(std::memory_order_relaxed)) /
+         static_cast<double>(total);
+}
+
+std::size_t
+MiterSplittingChecker::parallelism(const Configuration& config) noexcept {
+  return std::max(config.execution.nthreads, static_cast<std::size_t>(1U));
+}
+
+void MiterSplittingChecker::json(nlohmann::basic_json<>& j) const noexcept {
+  EquivalenceChecker::json(j);
+  j["checker"] = "decision_diagram_miter_splitting";
+  j["sub_miters"] = subMiters;
+  j["equivalent_sub_miters"] = checkedSubMiters;
+  j["max_sub_miter_size"] = maxSubMiterSize;
+  j["fallback"] = fallback;
+}
+} // namespace ec
@@ -10,20 +10,27 @@
 
 #include "checker/dd/applicationscheme/LookaheadApplicationScheme.hpp"
 
+#include "checker/dd/GarbageCollector.hpp"
 #include "checker/dd/TaskManager.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "dd/Node.hpp"
 #include "dd/Package.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <map>
+#include <memory>
 #include <utility>
+#include <vector>
 
 namespace ec {
 
 LookaheadApplicationScheme::LookaheadApplicationScheme(
     TaskManager<dd::MatrixDD>& tm1, TaskManager<dd::MatrixDD>& tm2) noexcept
     : ApplicationScheme(tm1, tm2) {}
+LookaheadApplicationScheme::~LookaheadApplicationScheme() { release(); }
 void LookaheadApplicationScheme::setInternalState(
     dd::MatrixDD& state) noexcept {
   internalState = &state;
@@ -31,49 +38,185 @@ void LookaheadApplicationScheme::setInternalState(
 void LookaheadApplicationScheme::setPackage(dd::Package* dd) noexcept {
   package = dd;
 }
-std::pair<size_t, size_t> LookaheadApplicationScheme::operator()() {
-  assert(internalState != nullptr);
-  assert(package != nullptr);
+void LookaheadApplicationScheme::setGarbageCollector(
+    GarbageCollector* collector) noexcept {
+  garbageCollector = collector;
+}
+void LookaheadApplicationScheme::setSearch(
+    const std::size_t lookaheadDepth, const std::size_t lookaheadBeamWidth,
+    const bool estimateSizes) noexcept {
+  depth = std::max(lookaheadDepth, static_cast<std::size_t>(1U));
+  beamWidth = lookaheadBeamWidth;
+  estimate = estimateSizes;
+}
+
+bool LookaheadApplicationScheme::available(const bool first,
+                                           const std::size_t count) {
+  auto& upcoming = first ? upcoming1 : upcoming2;
+  auto& peek = first ? peek1 : peek2;
+  if (!peek) {
+    // the copy starts at the current operation of the original task manager
+    peek = std::make_unique<TaskManager<dd::MatrixDD>>(first ? *taskManager1
+                                                             : *taskManager2);
+  }
+  while (upcoming.size() < count) {
+    peek->applySwapOperations();
+    if (peek->finished()) {
+      return false;
+    }
+    // operations of the second circuit are applied from the right
+    const auto gate = first ? peek->getDD() : peek->getInverseDD();
+    package->incRef(gate);
+    upcoming.emplace_back(gate);
+    peek->advanceIterator();
+  }
+  return true;
+}
 
-  if (!cached1) {
-    // cache the current operation
-    op1 = taskManager1->getDD();
-    package->incRef(op1);
-    cached1 = true;
+const dd::MatrixDD&
+LookaheadApplicationScheme::state(const Position& position,
+                                  const Position& parent) {
+  if (const auto it = lattice.find(position); it != lattice.end()) {
+    return it->second;
   }
+  const auto& from = parent == Position{0U, 0U} ? *internalState
+                                                 : lattice.at(parent);
+  const auto result =
+      position.first > parent.first
+          ? package->multiply(upcoming1[parent.first], from)
+          : package->multiply(from, upcoming2[parent.second]);
+  package->incRef(result);
+  return lattice.emplace(position, result).first->second;
+}
 
-  if (!cached2) {
-    // cache the current operation
-    op2 = taskManager2->getInverseDD();
-    package->incRef(op2);
-    cached2 = true;
+double LookaheadApplicationScheme::score(const Candidate& parent,
+                                         const Position& position) {
+  if (!estimate) {
+    return static_cast<double>(state(position, parent.position).size());
   }
+  // the size of a product is bounded by the product of the sizes of its
+  // factors (compared in the logarithmic domain)
+  const auto& gate = position.first > parent.position.first
+                         ? upcoming1[parent.position.first]
+                         : upcoming2[parent.position.second];
+  return parent.score + std::log2(static_cast<double>(gate.size()));
+}
 
-  // compute both possible applications and measure the resulting size
+bool LookaheadApplicationScheme::search() {
+  std::vector<Candidate> beam{
+      {{0U, 0U},
+       {0U, 0U},
+       estimate ? std::log2(static_cast<double>(internalState->size())) : 0.}};
+  std::map<Position, Position> parents{};
+  for (std::size_t level = 1U; level <= depth; ++level) {
+    std::vector<Candidate> next{};
+    const auto expand = [&](const Candidate& parent, const Position& position) {
+      // every position is only reached once per level (from the first parent)
+      if (parents.count(position) != 0U) {
+        return;
+      }
+      parents.emplace(position, parent.position);
+      next.emplace_back(
+          Candidate{position, parent.position, score(parent, position)});
+    };
+    for (const auto& candidate : beam) {
+      const auto [a, b] = candidate.position;
+      if (available(true, a + 1U)) {
+        expand(candidate, {a + 1U, b});
+      }
+      if (available(false, b + 1U)) {
+        expand(candidate, {a, b + 1U});
+      }
+    }
+    if (next.empty()) {
+      break;
+    }
+    // ties are resolved in favor of the first circuit
+    std::stable_sort(next.begin(), next.end(),
+                     [](const Candidate& lhs, const Candidate& rhs) {
+                       return lhs.score < rhs.score;
+                     });
+    if (beamWidth > 0U && next.size() > beamWidth) {
+      next.resize(beamWidth);
+    }
+    beam = std::move(next);
+  }
+
+  // trace the best state back to the first operation on its way
+  auto position = beam.front().position;
+  while (parents.at(position) != Position{0U, 0U}) {
+    position = parents.at(position);
+  }
+  return position.first == 1U;
+}
+
+void LookaheadApplicationScheme::step(const bool first) {
+  const Position target = first ? Position{1U, 0U} : Position{0U, 1U};
   auto saved = *internalState;
-  const auto dd1 = package->multiply(op1, saved);
-  const auto size1 = dd1.size();
-  const auto dd2 = package->multiply(saved, op2);
+  if (const auto it = lattice.find(target); it != lattice.end()) {
+    *internalState = it->second;
+  } else if (first) {
+    *internalState = package->multiply(upcoming1.front(), saved);
+  } else {
+    *internalState = package->multiply(saved, upcoming2.front());
+  }
+  package->incRef(*internalState);
+  package->decRef(saved);
 
-  // greedily chose the smaller resulting decision diagram
-  if (const auto size2 = dd2.size(); size1 <= size2) {
+  // only the states that are still reachable are kept
+  std::map<Position, dd::MatrixDD> reachable{};
+  for (const auto& [position, dd] : lattice) {
+    const auto [a, b] = position;
+    if ((first && a == 0U) || (!first && b == 0U) || position == target) {
+      package->decRef(dd);
+      continue;
+    }
+    reachable.emplace(first ? Position{a - 1U, b} : Position{a, b - 1U}, dd);
+  }
+  lattice = std::move(reachable);
+
+  auto& upcoming = first ? upcoming1 : upcoming2;
+  package->decRef(upcoming.front());
+  upcoming.pop_front();
+  if (first) {
     assert(!taskManager1->finished());
-    *internalState = dd1;
-    package->decRef(op1);
-    cached1 = false;
     taskManager1->advanceIterator();
   } else {
     assert(!taskManager2->finished());
-    *internalState = dd2;
-    package->decRef(op2);
-    cached2 = false;
     taskManager2->advanceIterator();
   }
+}
 
-  // properly track reference counts
-  package->incRef(*internalState);
-  package->decRef(saved);
-  package->garbageCollect();
+void LookaheadApplicationScheme::release() {
+  if (package != nullptr) {
+    for (const auto& [position, dd] : lattice) {
+      package->decRef(dd);
+    }
+    for (const auto* upcoming : {&upcoming1, &upcoming2}) {
+      for (const auto& gate : *upcoming) {
+        package->decRef(gate);
+      }
+    }
+  }
+  lattice.clear();
+  upcoming1.clear();
+  upcoming2.clear();
+  // the copies restart from the original task managers if needed again
+  peek1.reset();
+  peek2.reset();
+}
+
+std::pair<size_t, size_t> LookaheadApplicationScheme::operator()() {
+  assert(internalState != nullptr);
+  assert(package != nullptr);
+
+  step(search());
+
+  if (garbageCollector != nullptr) {
+    (*garbageCollector)();
+  } else {
+    package->garbageCollect();
+  }
 
   // no operations shall be applied by the outer loop in which the application
   // scheme is invoked
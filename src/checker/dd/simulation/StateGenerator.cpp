@@ -34,23 +34,80 @@ namespace ec {
 dd::VectorDD StateGenerator::generateRandomState(
     dd::Package& dd, const std::size_t totalQubits,
     const std::size_t ancillaryQubits, const StateType type) {
-  switch (type) {
-  case StateType::Random1QBasis:
-    return generateRandom1QBasisState(dd, totalQubits, ancillaryQubits);
-  case StateType::Stabilizer:
-    return generateRandomStabilizerState(dd, totalQubits, ancillaryQubits);
-  default:
-    return generateRandomComputationalBasisState(dd, totalQubits,
-                                                 ancillaryQubits);
-  }
+  return buildStimulus(dd,
+                       drawRandomStimulus(totalQubits, ancillaryQubits, type));
 }
 
 dd::VectorDD StateGenerator::generateRandomComputationalBasisState(
     dd::Package& dd, const std::size_t totalQubits,
     const std::size_t ancillaryQubits) {
+  return generateRandomState(dd, totalQubits, ancillaryQubits,
+                             StateType::ComputationalBasis);
+}
+
+dd::VectorDD
+StateGenerator::generateRandom1QBasisState(dd::Package& dd,
+                                           const std::size_t totalQubits,
+                                           const std::size_t ancillaryQubits) {
+  return generateRandomState(dd, totalQubits, ancillaryQubits,
+                             StateType::Random1QBasis);
+}
+
+dd::VectorDD StateGenerator::generateRandomStabilizerState(
+    dd::Package& dd, const std::size_t totalQubits,
+    const std::size_t ancillaryQubits) {
+  return generateRandomState(dd, totalQubits, ancillaryQubits,
+                             StateType::Stabilizer);
+}
+
+Stimulus StateGenerator::drawRandomStimulus(const std::size_t totalQubits,
+                                            const std::size_t ancillaryQubits,
+                                            const StateType type) {
+  Stimulus stimulus{};
+  stimulus.type = type;
+  stimulus.totalQubits = totalQubits;
+  stimulus.ancillaryQubits = ancillaryQubits;
+
   // determine how many qubits truly are random
   const std::size_t randomQubits = totalQubits - ancillaryQubits;
-  std::vector<bool> stimulusBits(totalQubits, false);
+
+  if (type == StateType::Stabilizer) {
+    // the random Clifford circuit is fully determined by its seed
+    stimulus.seed = mt();
+    return stimulus;
+  }
+
+  stimulus.basis =
+      std::vector<dd::BasisStates>(totalQubits, dd::BasisStates::zero);
+
+  if (type == StateType::Random1QBasis) {
+    // choose a random basis state for each qubit
+    for (std::size_t i = 0U; i < randomQubits; ++i) {
+      switch (random1QBasisDistribution(mt)) {
+      case static_cast<std::size_t>(dd::BasisStates::zero):
+        stimulus.basis[i] = dd::BasisStates::zero;
+        break;
+      case static_cast<std::size_t>(dd::BasisStates::one):
+        stimulus.basis[i] = dd::BasisStates::one;
+        break;
+      case static_cast<std::size_t>(dd::BasisStates::plus):
+        stimulus.basis[i] = dd::BasisStates::plus;
+        break;
+      case static_cast<std::size_t>(dd::BasisStates::minus):
+        stimulus.basis[i] = dd::BasisStates::minus;
+        break;
+      case static_cast<std::size_t>(dd::BasisStates::right):
+        stimulus.basis[i] = dd::BasisStates::right;
+        break;
+      case static_cast<std::size_t>(dd::BasisStates::left):
+        stimulus.basis[i] = dd::BasisStates::left;
+        break;
+      default:
+        qc::unreachable();
+      }
+    }
+    return stimulus;
+  }
 
   // check if there still is a unique computational basis state
   if (constexpr auto bitwidth = std::numeric_limits<std::uint64_t>::digits;
@@ -70,7 +127,7 @@ dd::VectorDD StateGenerator::generateRandomComputationalBasisState(
     // generate the bitvector corresponding to the random state
     for (std::size_t i = 0U; i < randomQubits; ++i) {
       if ((*randomState & (static_cast<std::uint64_t>(1U) << i)) != 0U) {
-        stimulusBits[i] = true;
+        stimulus.basis[i] = dd::BasisStates::one;
       }
     }
   } else {
@@ -86,64 +143,29 @@ dd::VectorDD StateGenerator::generateRandomComputationalBasisState(
     for (std::size_t i = 0U; i < randomQubits; ++i) {
       if ((randomNumbers[i / bitwidth] &
            (static_cast<std::uint_least64_t>(1U) << (i % bitwidth))) != 0U) {
-        stimulusBits[i] = true;
+        stimulus.basis[i] = dd::BasisStates::one;
       }
     }
   }
-
-  // return the appropriate decision diagram
-  return dd.makeBasisState(totalQubits, stimulusBits);
+  return stimulus;
 }
 
-dd::VectorDD
-StateGenerator::generateRandom1QBasisState(dd::Package& dd,
-                                           const std::size_t totalQubits,
-                                           const std::size_t ancillaryQubits) {
-  // determine how many qubits truly are random
-  const std::size_t randomQubits = totalQubits - ancillaryQubits;
-
-  // choose a random basis state for each qubit
-  auto randomBasisState =
-      std::vector<dd::BasisStates>(totalQubits, dd::BasisStates::zero);
-  for (std::size_t i = 0U; i < randomQubits; ++i) {
-    switch (random1QBasisDistribution(mt)) {
-    case static_cast<std::size_t>(dd::BasisStates::zero):
-      randomBasisState[i] = dd::BasisStates::zero;
-      break;
-    case static_cast<std::size_t>(dd::BasisStates::one):
-      randomBasisState[i] = dd::BasisStates::one;
-      break;
-    case static_cast<std::size_t>(dd::BasisStates::plus):
-      randomBasisState[i] = dd::BasisStates::plus;
-      break;
-    case static_cast<std::size_t>(dd::BasisStates::minus):
-      randomBasisState[i] = dd::BasisStates::minus;
-      break;
-    case static_cast<std::size_t>(dd::BasisStates::right):
-      randomBasisState[i] = dd::BasisStates::right;
-      break;
-    case static_cast<std::size_t>(dd::BasisStates::left):
-      randomBasisState[i] = dd::BasisStates::left;
-      break;
-    default:
-      qc::unreachable();
-    }
+dd::VectorDD StateGenerator::buildStimulus(dd::Package& dd,
+                                           const Stimulus& stimulus) {
+  if (stimulus.type != StateType::Stabilizer) {
+    // return the appropriate decision diagram
+    return dd.makeBasisState(stimulus.totalQubits, stimulus.basis);
   }
 
-  // return the appropriate decision diagram
-  return dd.makeBasisState(totalQubits, randomBasisState);
-}
-
-dd::VectorDD StateGenerator::generateRandomStabilizerState(
-    dd::Package& dd, const std::size_t totalQubits,
-    const std::size_t ancillaryQubits) {
   // determine how many qubits truly are random
-  const std::size_t randomQubits = totalQubits - ancillaryQubits;
+  const std::size_t randomQubits =
+      stimulus.totalQubits - stimulus.ancillaryQubits;
 
   // generate a random Clifford circuit with the appropriate depth
   const auto rcs = qc::createRandomCliffordCircuit(
       static_cast<qc::Qubit>(randomQubits),
-      static_cast<std::size_t>(std::round(std::log2(randomQubits))), mt());
+      static_cast<std::size_t>(std::round(std::log2(randomQubits))),
+      stimulus.seed);
 
   // generate the associated stabilizer state by simulating the Clifford
   // circuit
@@ -151,7 +173,7 @@ dd::VectorDD StateGenerator::generateRandomStabilizerState(
 
   // add |0> edges for all the ancillary qubits
   auto initial = stabilizer;
-  for (std::size_t p = randomQubits; p < totalQubits; ++p) {
+  for (std::size_t p = randomQubits; p < stimulus.totalQubits; ++p) {
     initial = dd.makeDDNode(static_cast<dd::Qubit>(p),
                             std::array{initial, dd::VectorDD::zero()});
     initial.p->ref = 1;
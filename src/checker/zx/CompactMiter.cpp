@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/zx/CompactMiter.hpp"
+
+#include "zx/ZXDefinitions.hpp"
+#include "zx/ZXDiagram.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ec {
+void CompactMiter::rebuild(const zx::ZXDiagram& diag) {
+  flags.clear();
+  types.clear();
+  offsets.clear();
+  degrees.clear();
+  capacities.clear();
+  targets.clear();
+  edgeTypes.clear();
+  tombstones = 0U;
+
+  for (const auto& [v, _] : diag.getVertices()) {
+    update(diag, v);
+  }
+}
+
+void CompactMiter::update(const zx::ZXDiagram& diag, const zx::Vertex v) {
+  if (v >= flags.size()) {
+    reserve(v + 1U);
+  }
+
+  if (diag.isDeleted(v)) {
+    tombstones += capacities[v];
+    flags[v] = DELETED;
+    degrees[v] = 0U;
+    capacities[v] = 0U;
+    return;
+  }
+
+  const auto& edges = diag.incidentEdges(v);
+  if (edges.size() > capacities[v]) {
+    // move the vertex to the end of the array with some room to grow, since
+    // the degree of vertices changes frequently during the simplification
+    tombstones += capacities[v];
+    offsets[v] = targets.size();
+    capacities[v] = edges.size() + (edges.size() / 2U);
+    targets.resize(targets.size() + capacities[v]);
+    edgeTypes.resize(edgeTypes.size() + capacities[v]);
+  }
+  degrees[v] = edges.size();
+  for (std::size_t k = 0U; k < edges.size(); ++k) {
+    targets[offsets[v] + k] = edges[k].to;
+    edgeTypes[offsets[v] + k] = edges[k].type;
+  }
+
+  types[v] = diag.type(v);
+  const auto& phase = diag.phase(v);
+  std::uint8_t f = 0U;
+  if (phase.isZero()) {
+    f |= ZERO;
+  }
+  if (phase.isPauli()) {
+    f |= PAULI;
+  }
+  if (phase.isProperClifford()) {
+    f |= PROPER_CLIFFORD;
+  }
+  flags[v] = f;
+
+  if (targets.size() >= MIN_COMPACTION_SIZE &&
+      2U * tombstones > targets.size()) {
+    compact();
+  }
+}
+
+void CompactMiter::reserve(const std::size_t nvertices) {
+  flags.resize(nvertices, DELETED);
+  types.resize(nvertices, zx::VertexType::Z);
+  offsets.resize(nvertices, 0U);
+  degrees.resize(nvertices, 0U);
+  capacities.resize(nvertices, 0U);
+}
+
+void CompactMiter::compact() {
+  std::vector<zx::Vertex> compactTargets{};
+  std::vector<zx::EdgeType> compactEdgeTypes{};
+  compactTargets.reserve(targets.size() - tombstones);
+  compactEdgeTypes.reserve(targets.size() - tombstones);
+  for (zx::Vertex v = 0U; v < flags.size(); ++v) {
+    const auto begin = offsets[v];
+    offsets[v] = compactTargets.size();
+    capacities[v] = degrees[v];
+    for (auto k = begin; k < begin + degrees[v]; ++k) {
+      compactTargets.emplace_back(targets[k]);
+      compactEdgeTypes.emplace_back(edgeTypes[k]);
+    }
+  }
+  targets = std::move(compactTargets);
+  edgeTypes = std::move(compactEdgeTypes);
+  tombstones = 0U;
+}
+} // namespace ec
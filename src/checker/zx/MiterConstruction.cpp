@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/zx/MiterConstruction.hpp"
+
+#include "checker/zx/ZXChecker.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "zx/ZXDefinitions.hpp"
+#include "zx/ZXDiagram.hpp"
+
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+namespace ec {
+MiterConstruction::Miter
+MiterConstruction::build(const qc::QuantumComputation& qc1,
+                         const qc::QuantumComputation& qc2) {
+  Miter miter{buildFunctionality(&qc1), {}};
+  auto& diag = miter.diagram;
+
+  const auto& p1 = invertPermutations(qc1);
+  const auto& p2 = invertPermutations(qc2);
+
+  // fix ancillaries of the first circuit to |0>
+  const auto nqubits = qc1.getNqubits();
+  const auto nQubitsWithoutAncillae = qc1.getNqubitsWithoutAncillae();
+  for (auto anc = static_cast<zx::Qubit>(nqubits - 1U);
+       anc >= static_cast<zx::Qubit>(nQubitsWithoutAncillae); --anc) {
+    diag.makeAncilla(
+        anc, static_cast<zx::Qubit>(p1.at(static_cast<qc::Qubit>(anc))));
+  }
+  diag.invert();
+
+  // The outputs of D_1^† are the inputs of D_1, i.e., one per qubit that is
+  // not an ancillary. They are detached from the diagram and the operations of
+  // the second circuit are appended to the spiders they were connected to. An
+  // identity spider keeps the type of the detached edge.
+  const auto outputs = diag.getOutputs();
+  std::vector<zx::Vertex> qubits(nqubits);
+  for (std::size_t i = 0U; i < outputs.size(); ++i) {
+    const auto [v, type] = diag.incidentEdge(outputs[i], 0U);
+    diag.removeEdge(v, outputs[i]);
+    qubits[i] = diag.addVertex(static_cast<zx::Qubit>(i));
+    diag.addEdge(v, qubits[i], type);
+  }
+  // the ancillaries of the second circuit start in |0>
+  for (auto anc = nQubitsWithoutAncillae; anc < nqubits; ++anc) {
+    qubits[anc] = diag.addVertex(static_cast<zx::Qubit>(anc), 0,
+                                 zx::PiExpression(), zx::VertexType::X);
+  }
+
+  for (auto it = qc2.cbegin(); it != qc2.cend();) {
+    it = parseOp(diag, it, qc2.cend(), qubits, qc2.initialLayout);
+  }
+
+  // the ancillaries of the second circuit end in <0|, all remaining qubits are
+  // connected to the outputs of the miter in order
+  std::unordered_set<std::size_t> ancillaOutputs{};
+  for (auto anc = nQubitsWithoutAncillae; anc < nqubits; ++anc) {
+    ancillaOutputs.emplace(p2.at(static_cast<qc::Qubit>(anc)));
+  }
+  std::size_t output = 0U;
+  for (std::size_t q = 0U; q < nqubits; ++q) {
+    if (ancillaOutputs.count(q) != 0U) {
+      const auto v = diag.addVertex(static_cast<zx::Qubit>(q), 0,
+                                    zx::PiExpression(), zx::VertexType::X);
+      diag.addEdge(qubits[q], v);
+      continue;
+    }
+    diag.addEdge(qubits[q], outputs[output]);
+    miter.outputQubits.emplace(outputs[output], static_cast<zx::Qubit>(q));
+    ++output;
+  }
+  return miter;
+}
+} // namespace ec
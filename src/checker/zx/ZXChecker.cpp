@@ -13,28 +13,401 @@
 #include "Configuration.hpp"
 #include "EquivalenceCriterion.hpp"
 #include "checker/EquivalenceChecker.hpp"
+#include "checker/zx/CompactMiter.hpp"
+#include "checker/zx/MiterConstruction.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/QuantumComputation.hpp"
-#include "zx/FunctionalityConstruction.hpp"
 #include "zx/Rules.hpp"
 #include "zx/ZXDefinitions.hpp"
 #include "zx/ZXDiagram.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 namespace ec {
+namespace {
+/// The simplification rules in the order of their priority
+enum class Rule : std::uint8_t {
+  SpiderFusion,
+  IdRemoval,
+  PivotPauli,
+  LocalComplementation,
+  Pivot,
+  GadgetFusion,
+  PivotGadget
+};
+constexpr std::size_t NRULES = static_cast<std::size_t>(Rule::PivotGadget) + 1U;
+
+// minimum number of vertices per task when searching for matches concurrently
+constexpr std::size_t MIN_MATCHING_CHUNK = 256U;
+
+/// The vertices of the miter that have to be (re-)checked for every rule
+class Worklist {
+public:
+  Worklist() : queues(NRULES), queued(NRULES) {}
+
+  /// Schedule a vertex (and the edges incident to it) for all rules
+  void push(const zx::Vertex v) {
+    for (std::size_t r = 0U; r < NRULES; ++r) {
+      if (v >= queued[r].size()) {
+        queued[r].resize(v + 1U, false);
+      }
+      if (!queued[r][v]) {
+        queued[r][v] = true;
+        queues[r].emplace_back(v);
+      }
+    }
+  }
+
+  /// Returns the next vertex to check for the rule with the highest priority
+  std::optional<std::pair<Rule, zx::Vertex>> pop() {
+    for (std::size_t r = 0U; r < NRULES; ++r) {
+      if (queues[r].empty()) {
+        continue;
+      }
+      const auto v = queues[r].front();
+      queues[r].pop_front();
+      queued[r][v] = false;
+      return std::pair{static_cast<Rule>(r), v};
+    }
+    return std::nullopt;
+  }
+
+  /// Returns all vertices to check for the rule with the highest priority
+  std::optional<std::pair<Rule, std::vector<zx::Vertex>>> popAll() {
+    for (std::size_t r = 0U; r < NRULES; ++r) {
+      if (queues[r].empty()) {
+        continue;
+      }
+      std::vector<zx::Vertex> vertices(queues[r].begin(), queues[r].end());
+      queues[r].clear();
+      for (const auto v : vertices) {
+        queued[r][v] = false;
+      }
+      return std::pair{static_cast<Rule>(r), std::move(vertices)};
+    }
+    return std::nullopt;
+  }
+
+private:
+  std::vector<std::deque<zx::Vertex>> queues;
+  std::vector<std::vector<bool>> queued;
+};
+
+/**
+ * The neighbourhood of a match. All vertices that might be changed by a
+ * rewrite are within `radius` of the matched vertices. These vertices, as well
+ * as the vertices surrounding them, are recorded before the rewrite, so that
+ * vertices added by the rewrite can be told apart afterwards.
+ */
+struct Region {
+  std::vector<zx::Vertex> inner;
+  std::unordered_set<zx::Vertex> known;
+};
+
+Region region(const CompactMiter& compact, std::vector<zx::Vertex> frontier,
+              const std::size_t radius) {
+  Region result{frontier, {frontier.begin(), frontier.end()}};
+  for (std::size_t d = 0U; d <= radius; ++d) {
+    std::vector<zx::Vertex> next{};
+    for (const auto v : frontier) {
+      const auto end = compact.offset(v) + compact.degree(v);
+      for (auto k = compact.offset(v); k < end; ++k) {
+        const auto w = compact.target(k);
+        if (result.known.insert(w).second) {
+          next.emplace_back(w);
+        }
+      }
+    }
+    if (d < radius) {
+      result.inner.insert(result.inner.end(), next.begin(), next.end());
+    }
+    frontier = std::move(next);
+  }
+  return result;
+}
+
+// Reschedule everything whose applicability might have changed by rewriting
+// the given region and bring the compact mirror of these vertices up to date.
+// The checks of all rules only depend on the involved vertices and their
+// direct neighbours. Hence, all vertices adjacent to a changed vertex are
+// rescheduled. Vertices added by the rewrite are adjacent to the region, but
+// might have further new neighbours.
+void reschedule(const zx::ZXDiagram& diag, CompactMiter& compact,
+                Worklist& worklist, const Region& rewritten) {
+  std::unordered_set<zx::Vertex> updated{};
+  const auto touch = [&](const zx::Vertex v) {
+    if (updated.insert(v).second) {
+      compact.update(diag, v);
+      worklist.push(v);
+    }
+  };
+  for (const auto v : rewritten.inner) {
+    if (diag.isDeleted(v)) {
+      compact.update(diag, v);
+      continue;
+    }
+    touch(v);
+    for (const auto& [w, _] : diag.incidentEdges(v)) {
+      touch(w);
+      if (rewritten.known.count(w) == 0U) {
+        for (const auto& edge : diag.incidentEdges(w)) {
+          touch(edge.to);
+        }
+      }
+    }
+  }
+}
+
+/// A match of a rule. For rules matching a single vertex, both vertices
+/// coincide.
+struct Match {
+  zx::Vertex v0;
+  zx::Vertex v1;
+  Region region;
+};
+
+// Necessary conditions for the rules to match at a single vertex or edge,
+// respectively. These are checked on the compact mirror of the miter before
+// the actual check of the rule is performed on the diagram.
+bool mayMatchVertex(const CompactMiter& compact, const Rule rule,
+                    const zx::Vertex v) {
+  switch (rule) {
+  case Rule::IdRemoval:
+    return compact.degree(v) == 2U && compact.hasZeroPhase(v);
+  case Rule::LocalComplementation:
+    return compact.hasProperCliffordPhase(v);
+  default:
+    return true;
+  }
+}
+
+bool mayMatchEdge(const CompactMiter& compact, const Rule rule,
+                  const zx::Vertex v0, const zx::Vertex v1,
+                  const zx::EdgeType type) {
+  if (compact.isBoundary(v0) || compact.isBoundary(v1)) {
+    return false;
+  }
+  switch (rule) {
+  case Rule::SpiderFusion:
+    return type == zx::EdgeType::Simple && compact.type(v0) == compact.type(v1);
+  case Rule::PivotPauli:
+  case Rule::Pivot:
+    return type == zx::EdgeType::Hadamard && compact.hasPauliPhase(v0) &&
+           compact.hasPauliPhase(v1);
+  case Rule::PivotGadget:
+    return type == zx::EdgeType::Hadamard &&
+           (compact.hasPauliPhase(v0) || compact.hasPauliPhase(v1));
+  default:
+    return true;
+  }
+}
+
+template <class CheckFun>
+std::optional<Match> matchVertex(const zx::ZXDiagram& diag,
+                                 const CompactMiter& compact, const Rule rule,
+                                 const zx::Vertex v, CheckFun check) {
+  if (compact.isBoundary(v) || !mayMatchVertex(compact, rule, v) ||
+      !check(diag, v)) {
+    return std::nullopt;
+  }
+  return Match{v, v, region(compact, {v}, 1U)};
+}
+
+template <class CheckFun>
+std::optional<Match> matchEdge(const zx::ZXDiagram& diag,
+                               const CompactMiter& compact, const Rule rule,
+                               const zx::Vertex v, CheckFun check) {
+  const auto end = compact.offset(v) + compact.degree(v);
+  for (auto k = compact.offset(v); k < end; ++k) {
+    const auto w = compact.target(k);
+    // edges are checked in the same orientation as they are enumerated by the
+    // diagram
+    const auto v0 = std::min(v, w);
+    const auto v1 = std::max(v, w);
+    if (mayMatchEdge(compact, rule, v0, v1, compact.edgeType(k)) &&
+        check(diag, v0, v1)) {
+      return Match{v0, v1, region(compact, {v0, v1}, 1U)};
+    }
+  }
+  return std::nullopt;
+}
+
+/// Find a match of a rule at the given vertex without changing the diagram
+std::optional<Match> findMatch(const zx::ZXDiagram& diag,
+                               const CompactMiter& compact, const Rule rule,
+                               const zx::Vertex v) {
+  switch (rule) {
+  case Rule::SpiderFusion:
+    return matchEdge(diag, compact, rule, v, zx::checkSpiderFusion);
+  case Rule::IdRemoval:
+    return matchVertex(diag, compact, rule, v, zx::checkIdSimp);
+  case Rule::PivotPauli:
+    return matchEdge(diag, compact, rule, v, zx::checkPivotPauli);
+  case Rule::LocalComplementation:
+    return matchVertex(diag, compact, rule, v, zx::checkLocalComp);
+  case Rule::Pivot:
+    return matchEdge(diag, compact, rule, v, zx::checkPivot);
+  case Rule::PivotGadget:
+    return matchEdge(diag, compact, rule, v, zx::checkPivotGadget);
+  case Rule::GadgetFusion:
+    // gadgets are checked and fused in one go (see `fuseGadget`)
+    break;
+  }
+  return std::nullopt;
+}
+
+void applyMatch(zx::ZXDiagram& diag, CompactMiter& compact, Worklist& worklist,
+                const Rule rule, const Match& match) {
+  switch (rule) {
+  case Rule::SpiderFusion:
+    zx::fuseSpiders(diag, match.v0, match.v1);
+    break;
+  case Rule::IdRemoval:
+    zx::removeId(diag, match.v0);
+    break;
+  case Rule::PivotPauli:
+    zx::pivotPauli(diag, match.v0, match.v1);
+    break;
+  case Rule::LocalComplementation:
+    zx::localComp(diag, match.v0);
+    break;
+  case Rule::Pivot:
+    zx::pivot(diag, match.v0, match.v1);
+    break;
+  case Rule::PivotGadget:
+    zx::pivotGadget(diag, match.v0, match.v1);
+    break;
+  case Rule::GadgetFusion:
+    break;
+  }
+  reschedule(diag, compact, worklist, match.region);
+}
+
+// phase gadgets are matched via their leaves, which are either the vertex
+// itself or one of its neighbours
+bool fuseGadget(zx::ZXDiagram& diag, CompactMiter& compact, Worklist& worklist,
+                const zx::Vertex v) {
+  std::vector<zx::Vertex> leaves{};
+  if (compact.degree(v) == 1U) {
+    leaves.emplace_back(v);
+  }
+  const auto end = compact.offset(v) + compact.degree(v);
+  for (auto k = compact.offset(v); k < end; ++k) {
+    if (compact.degree(compact.target(k)) == 1U) {
+      leaves.emplace_back(compact.target(k));
+    }
+  }
+  for (const auto leaf : leaves) {
+    // fusing changes the support of the gadget, i.e., the vertices at
+    // distance two from the leaf
+    const auto rewritten = region(compact, {leaf}, 2U);
+    if (zx::checkAndFuseGadget(diag, leaf)) {
+      reschedule(diag, compact, worklist, rewritten);
+      return true;
+    }
+  }
+  return false;
+}
+
+/// Check a rule at a single vertex and apply it if possible
+bool simplifyAt(zx::ZXDiagram& diag, CompactMiter& compact, Worklist& worklist,
+                const Rule rule, const zx::Vertex v) {
+  // fusing gadgets may delete vertices outside of the rewritten region, which
+  // are only tombstoned in the mirror once it is rebuilt
+  if (diag.isDeleted(v)) {
+    return false;
+  }
+  if (rule == Rule::GadgetFusion) {
+    return fuseGadget(diag, compact, worklist, v);
+  }
+  const auto match = findMatch(diag, compact, rule, v);
+  if (!match.has_value()) {
+    return false;
+  }
+  applyMatch(diag, compact, worklist, rule, *match);
+  return true;
+}
+
+/// Find the matches of a rule at the given vertices concurrently. The vertices
+/// are split into at most `maxChunks` contiguous chunks, each of which is
+/// searched by a single iteration of the parallel loop `forEach`.
+template <class ForEach, class StopFun>
+std::vector<std::optional<Match>>
+findMatches(const zx::ZXDiagram& diag, const CompactMiter& compact,
+            const Rule rule, const std::vector<zx::Vertex>& vertices,
+            const std::size_t maxChunks, ForEach forEach, StopFun stop) {
+  std::vector<std::optional<Match>> matches(vertices.size());
+  const auto search = [&](const std::size_t begin, const std::size_t end) {
+    for (auto i = begin; i < end && !stop(); ++i) {
+      if (!diag.isDeleted(vertices[i])) {
+        matches[i] = findMatch(diag, compact, rule, vertices[i]);
+      }
+    }
+  };
+
+  const auto nchunks =
+      std::clamp((vertices.size() + MIN_MATCHING_CHUNK - 1U) /
+                     MIN_MATCHING_CHUNK,
+                 std::size_t{1U}, std::max(maxChunks, std::size_t{1U}));
+  const auto chunkSize = (vertices.size() + nchunks - 1U) / nchunks;
+  forEach(nchunks, [&](const std::size_t c) {
+    const auto begin = std::min(c * chunkSize, vertices.size());
+    search(begin, std::min(begin + chunkSize, vertices.size()));
+  });
+  return matches;
+}
+
+/// Apply a maximal set of matches whose neighbourhoods do not overlap. As the
+/// checks of a match only depend on its neighbourhood, the remaining matches
+/// are still valid after applying any of them. The vertices of all skipped
+/// matches are checked again later on.
+template <class StopFun>
+bool applyIndependentMatches(zx::ZXDiagram& diag, CompactMiter& compact,
+                             Worklist& worklist, const Rule rule,
+                             const std::vector<zx::Vertex>& vertices,
+                             const std::vector<std::optional<Match>>& matches,
+                             StopFun stop) {
+  auto applied = false;
+  std::unordered_set<zx::Vertex> claimed{};
+  for (std::size_t i = 0U; i < matches.size() && !stop(); ++i) {
+    if (!matches[i].has_value()) {
+      continue;
+    }
+    const auto& match = *matches[i];
+    const auto overlaps =
+        std::any_of(match.region.known.begin(), match.region.known.end(),
+                    [&](const auto v) { return claimed.count(v) != 0U; });
+    if (overlaps) {
+      worklist.push(vertices[i]);
+      continue;
+    }
+    claimed.insert(match.region.known.begin(), match.region.known.end());
+    applyMatch(diag, compact, worklist, rule, match);
+    applied = true;
+  }
+  return applied;
+}
+} // namespace
+
 ZXEquivalenceChecker::ZXEquivalenceChecker(const qc::QuantumComputation& circ1,
                                            const qc::QuantumComputation& circ2,
                                            Configuration config) noexcept
     : EquivalenceChecker(circ1, circ2, std::move(config)),
-      miter(zx::FunctionalityConstruction::buildFunctionality(qc1)),
       tolerance(configuration.functionality.traceThreshold) {
-  zx::ZXDiagram dPrime = zx::FunctionalityConstruction::buildFunctionality(qc2);
+  auto constructed = MiterConstruction::build(*qc1, *qc2);
+  miter = std::move(constructed.diagram);
+  outputQubits = std::move(constructed.outputQubits);
 
   if ((qc1->getNancillae() != 0U) || (qc2->getNancillae() != 0U)) {
     ancilla = true;
@@ -42,19 +415,51 @@ ZXEquivalenceChecker::ZXEquivalenceChecker(const qc::QuantumComputation& circ1,
 
   const auto& p1 = invertPermutations(*qc1);
   const auto& p2 = invertPermutations(*qc2);
+  inputPermutation = invert(p1);
+  outputPermutation = invert(p2);
+  const auto& inputs = miter.getInputs();
+  for (std::size_t i = 0U; i < inputs.size(); ++i) {
+    inputIndices.emplace(inputs[i], i);
+  }
+}
 
-  // fix ancillaries to |0>
-  const auto nQubitsWithoutAncillae =
-      static_cast<zx::Qubit>(qc1->getNqubitsWithoutAncillae());
-  for (auto anc = static_cast<zx::Qubit>(qc1->getNqubits() - 1U);
-       anc >= nQubitsWithoutAncillae; --anc) {
-    miter.makeAncilla(
-        anc, static_cast<zx::Qubit>(p1.at(static_cast<qc::Qubit>(anc))));
-    dPrime.makeAncilla(
-        anc, static_cast<zx::Qubit>(p2.at(static_cast<qc::Qubit>(anc))));
-  }
-  miter.invert();
-  miter.concat(dPrime);
+std::optional<bool>
+ZXEquivalenceChecker::wiredToIdentity(const std::size_t i) const {
+  if (qc1->logicalQubitIsGarbage(static_cast<qc::Qubit>(i)) &&
+      qc2->logicalQubitIsGarbage(static_cast<qc::Qubit>(i))) {
+    return true;
+  }
+
+  const auto& in = miter.getInput(i);
+  const auto& edge = miter.incidentEdge(in, 0U);
+  const auto& out = edge.to;
+  if (!miter.isBoundaryVertex(out)) {
+    return std::nullopt;
+  }
+  if (edge.type == zx::EdgeType::Hadamard || !miter.isOutput(out)) {
+    return false;
+  }
+  const auto& q1 = miter.getVData(in);
+  assert(q1.has_value());
+  return inputPermutation.at(static_cast<qc::Qubit>(q1->qubit)) ==
+         outputPermutation.at(static_cast<qc::Qubit>(outputQubits.at(out)));
+}
+
+bool ZXEquivalenceChecker::isMiswired(const zx::Vertex v) const {
+  if (miter.isDeleted(v) || !miter.isBoundaryVertex(v) ||
+      miter.degree(v) != 1U) {
+    return false;
+  }
+  auto in = v;
+  if (!miter.isInput(in)) {
+    in = miter.incidentEdge(v, 0U).to;
+  }
+  const auto it = inputIndices.find(in);
+  if (it == inputIndices.end()) {
+    return false;
+  }
+  const auto wired = wiredToIdentity(it->second);
+  return wired.has_value() && !*wired;
 }
 
 EquivalenceCriterion ZXEquivalenceChecker::run() {
@@ -62,39 +467,9 @@ EquivalenceCriterion ZXEquivalenceChecker::run() {
 
   fullReduceApproximate();
 
-  bool equivalent = true;
-
-  if (miter.getNEdges() == miter.getNQubits()) {
-    const auto& p1 = invert(invertPermutations(*qc1));
-    const auto& p2 = invert(invertPermutations(*qc2));
-
-    const auto nQubits = miter.getNQubits();
-    for (std::size_t i = 0U; i < nQubits; ++i) {
-      if (qc1->logicalQubitIsGarbage(static_cast<qc::Qubit>(i)) &&
-          qc2->logicalQubitIsGarbage(static_cast<qc::Qubit>(i))) {
-        continue;
-      }
-
-      const auto& in = miter.getInput(i);
-      const auto& edge = miter.incidentEdge(in, 0U);
-
-      if (edge.type == zx::EdgeType::Hadamard) {
-        equivalent = false;
-        break;
-      }
-      const auto& out = edge.to;
-      const auto& q1 = miter.getVData(in);
-      const auto& q2 = miter.getVData(out);
-      assert(q1.has_value());
-      assert(q2.has_value());
-      if (p1.at(static_cast<qc::Qubit>(q1->qubit)) !=
-          p2.at(static_cast<qc::Qubit>(q2->qubit))) {
-        equivalent = false;
-        break;
-      }
-    }
-  } else {
-    equivalent = false;
+  bool equivalent = !miswired && miter.getNEdges() == miter.getNQubits();
+  for (std::size_t i = 0U; equivalent && i < miter.getNQubits(); ++i) {
+    equivalent = wiredToIdentity(i).value_or(false);
   }
 
   const auto end = std::chrono::steady_clock::now();
@@ -178,7 +553,7 @@ qc::Permutation invertPermutations(const qc::QuantumComputation& qc) {
 
 bool ZXEquivalenceChecker::fullReduceApproximate() {
   auto simplified = fullReduce();
-  while (!isDone()) {
+  while (!stopSimplification()) {
     miter.approximateCliffords(tolerance);
     if (!fullReduce()) {
       break;
@@ -189,70 +564,75 @@ bool ZXEquivalenceChecker::fullReduceApproximate() {
 }
 
 bool ZXEquivalenceChecker::fullReduce() {
-  if (!isDone()) {
+  if (!stopSimplification()) {
     miter.toGraphlike();
+    // the conversion (and the approximation of phases before) may change any
+    // vertex of the miter
+    compact.rebuild(miter);
   }
-  auto simplified = interiorCliffordSimp();
-  while (!isDone()) {
-    auto moreSimplified = cliffordSimp();
-    moreSimplified |= gadgetSimp();
-    moreSimplified |= interiorCliffordSimp();
-    moreSimplified |= pivotGadgetSimp();
-    if (!moreSimplified) {
-      break;
-    }
-    simplified = true;
-  }
-  if (!isDone()) {
+  const auto simplified = simplify();
+  if (!stopSimplification()) {
     miter.removeDisconnectedSpiders();
   }
   return simplified;
 }
 
-bool ZXEquivalenceChecker::gadgetSimp() {
+bool ZXEquivalenceChecker::simplify() {
+  Worklist worklist{};
+  for (zx::Vertex v = 0U; v < compact.size(); ++v) {
+    if (!compact.isDeleted(v)) {
+      worklist.push(v);
+    }
+  }
+
+  const auto stop = [this] { return stopSimplification(); };
+  // the matches are searched on the helper threads granted to the checker
+  const auto forEach = [this](const std::size_t n, const auto& body) {
+    parallelFor(n, body);
+  };
+  const auto threads = configuration.execution.zxThreads;
   auto simplified = false;
-  while (!isDone()) {
-    auto moreSimplified = false;
-    for (const auto& [v, _] : miter.getVertices()) {
-      if (miter.isDeleted(v)) {
-        continue;
+  while (!stopSimplification()) {
+    if (threads <= 1U) {
+      const auto next = worklist.pop();
+      if (!next.has_value()) {
+        break;
       }
-      if (checkAndFuseGadget(miter, v)) {
-        moreSimplified = true;
+      // every rescheduled vertex passes the queue of the first rule, which is
+      // where the wiring of boundaries is tracked
+      if (next->first == Rule::SpiderFusion && isMiswired(next->second)) {
+        miswired = true;
+        break;
       }
+      simplified |=
+          simplifyAt(miter, compact, worklist, next->first, next->second);
+      continue;
     }
-    if (!moreSimplified) {
-      break;
-    }
-    simplified = true;
-  }
-  return simplified;
-}
 
-bool ZXEquivalenceChecker::interiorCliffordSimp() {
-  auto simplified = spiderSimp();
-  while (!isDone()) {
-    auto moreSimplified = idSimp();
-    moreSimplified |= spiderSimp();
-    moreSimplified |= pivotPauliSimp();
-    moreSimplified |= localCompSimp();
-    if (!moreSimplified) {
+    const auto next = worklist.popAll();
+    if (!next.has_value()) {
       break;
     }
-    simplified = true;
-  }
-  return simplified;
-}
-
-bool ZXEquivalenceChecker::cliffordSimp() {
-  auto simplified = false;
-  while (!isDone()) {
-    auto moreSimplified = interiorCliffordSimp();
-    moreSimplified |= pivotSimp();
-    if (!moreSimplified) {
+    const auto& [rule, vertices] = *next;
+    if (rule == Rule::SpiderFusion &&
+        std::any_of(vertices.begin(), vertices.end(),
+                    [this](const auto v) { return isMiswired(v); })) {
+      miswired = true;
       break;
     }
-    simplified = true;
+    if (rule == Rule::GadgetFusion) {
+      for (const auto v : vertices) {
+        if (stopSimplification()) {
+          break;
+        }
+        simplified |= simplifyAt(miter, compact, worklist, rule, v);
+      }
+      continue;
+    }
+    const auto matches =
+        findMatches(miter, compact, rule, vertices, threads, forEach, stop);
+    simplified |= applyIndependentMatches(miter, compact, worklist, rule,
+                                          vertices, matches, stop);
   }
   return simplified;
 }
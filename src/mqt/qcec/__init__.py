@@ -32,11 +32,12 @@ if sys.platform == "win32":
     del _dll_patch
 
 from ._version import version as __version__
-from .verify import verify
+from .verify import verify, verify_batch
 from .verify_compilation_flow import verify_compilation
 
 __all__ = [
     "__version__",
     "verify",
+    "verify_batch",
     "verify_compilation",
 ]
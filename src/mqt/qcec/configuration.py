@@ -13,7 +13,7 @@ from __future__ import annotations
 from typing import TYPE_CHECKING, TypedDict
 
 if TYPE_CHECKING:
-    from .pyqcec import ApplicationScheme, Configuration, StateType
+    from .pyqcec import ApplicationScheme, Configuration, GarbageCollectionPolicy, StateType
 
 __all__ = ["ConfigurationOptions", "augment_config_from_kwargs"]
 
@@ -30,19 +30,38 @@ class ConfigurationOptions(TypedDict, total=False):
     """
 
     # Application
+    alternating_portfolio: list[ApplicationScheme | str]
     alternating_scheme: ApplicationScheme | str
+    cancellation_window: int
     construction_scheme: ApplicationScheme | str
+    lookahead_beam_width: int
+    lookahead_depth: int
+    lookahead_size_estimate: bool
     simulation_scheme: ApplicationScheme | str
     profile: str
     # Execution
+    adaptive_table_sizing: bool
+    cancellation_grace_period: float
+    compute_table_buckets: int
+    construction_segments: int
+    gate_cache_size: int
+    gc_high_water_mark: int
+    gc_interval: int
+    gc_load_factor: float
+    gc_policy: GarbageCollectionPolicy | str
+    memory_budget: int
     nthreads: int
     numerical_tolerance: float
     parallel: bool
+    reassign_idle_threads: bool
     run_alternating_checker: bool
     run_construction_checker: bool
     run_simulation_checker: bool
     run_zx_checker: bool
+    split_miters: bool
     timeout: float
+    unique_table_buckets: int
+    zx_threads: int
     # Functionality
     trace_threshold: float
     check_partial_equivalence: bool
@@ -58,8 +77,12 @@ class ConfigurationOptions(TypedDict, total=False):
     additional_instantiations: int
     parameterized_tolerance: float
     # Simulation
+    adaptive_sims: bool
+    batch_size: int
     fidelity_threshold: float
+    initial_sims: int
     max_sims: int
+    persistent_workers: bool
     seed: int
     state_type: StateType | str
 
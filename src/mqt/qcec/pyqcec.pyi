@@ -8,6 +8,7 @@
 
 """The Python interface for QCEC."""
 
+from collections.abc import Callable
 from typing import Any, ClassVar, Literal, overload
 
 from mqt.core.dd import VectorDD
@@ -82,6 +83,9 @@ class EquivalenceCheckingManager:
         performed_simulations: int
         """Number of simulations that have been finished."""
 
+        simulations_aborted: bool
+        """Whether the simulations have been stopped early because a simulation exceeded its memory budget."""
+
         cex_input: VectorDD
         """DD representation of the initial state that produced a counterexample."""
 
@@ -106,6 +110,40 @@ class EquivalenceCheckingManager:
         def json(self) -> dict[str, Any]:
             """Returns a JSON-style dictionary of the results."""
 
+class BatchEquivalenceChecker:
+    """Checks the equivalence of many pairs of circuits with a shared :class:`.Configuration`.
+
+    The checks are scheduled on a pool of up to :attr:`~.Configuration.Execution.nthreads` worker threads.
+    If there are at least as many pairs as threads, every pair is checked sequentially on one thread.
+    Otherwise, the threads are distributed among the pairs and every pair that is checked at once gets a pool of its share of the threads for its checkers.
+    At most :attr:`~.Configuration.Execution.nthreads` threads are busy checking at any time, while up to twice as many threads exist during a run.
+    """
+    def __init__(self, config: Configuration = ...) -> None:
+        """Create a batch of equivalence checks that all use the given :class:`.Configuration`."""
+
+    def add_pair(self, circ1: QuantumComputation, circ2: QuantumComputation) -> int:
+        """Add a pair of circuits to the batch and return its index."""
+
+    def run(self, callback: Callable[[int, EquivalenceCheckingManager.Results], None] | None = None) -> None:
+        """Check all pairs of the batch.
+
+        Arguments:
+            callback: Called with the index of a pair and its results as soon as the pair has been checked. Calls are serialized, but may happen from any worker thread.
+        """
+
+    def clear(self) -> None:
+        """Remove all pairs and results from the batch."""
+
+    def __len__(self) -> int: ...
+    def results(self, index: int) -> EquivalenceCheckingManager.Results:
+        """The results of the pair with the given index."""
+
+    @property
+    def configuration(self) -> Configuration: ...
+    @configuration.setter
+    def configuration(self, config: Configuration) -> None:
+        """The configuration used for all pairs."""
+
 class Configuration:
     """Provides all the means to configure QCEC.
 
@@ -183,6 +221,129 @@ class Configuration:
         Defaults to :code:`2e-13` and should only be changed by users who know what they are doing.
         """
 
+        gate_cache_size: int = 0
+        """The maximum number of gate decision diagrams cached per decision diagram package.
+
+        Compiled circuits frequently contain the same gate (after accounting for the current qubit permutation) many times.
+        With a positive cache size, the decision diagrams of the most recently used gates are kept alive and reused instead of being reconstructed for every occurrence.
+
+        Defaults to :code:`0`, which disables the cache.
+        """
+
+        gc_policy: GarbageCollectionPolicy = ...
+        """The :class:`policy <.GarbageCollectionPolicy>` that determines when garbage is collected in the decision diagram packages while applying gates.
+
+        Collecting less frequently increases throughput at the cost of a higher peak memory usage.
+
+        Defaults to :attr:`.GarbageCollectionPolicy.always`.
+        """
+
+        gc_interval: int = 64
+        """The number of gates in between two garbage collections when using the :attr:`.GarbageCollectionPolicy.periodic` policy.
+
+        Defaults to :code:`64`.
+        """
+
+        gc_load_factor: float = 2.0
+        """The maximum number of unique table entries per bucket before garbage is collected when using the :attr:`.GarbageCollectionPolicy.load_factor` policy.
+
+        Defaults to :code:`2.0`.
+        """
+
+        gc_high_water_mark: int = 1024
+        """The estimated memory (in MiB) of the nodes and compute tables above which garbage is collected when using the :attr:`.GarbageCollectionPolicy.high_water_mark` policy.
+
+        Defaults to :code:`1024`.
+        """
+
+        memory_budget: int = 0
+        """The maximum memory (in MiB) that the nodes and compute tables of a single decision diagram-based checker may occupy.
+
+        Once the budget is exceeded (even after collecting garbage), the respective checker stops without a result and reports the reason under :code:`abort_reason` in its results.
+        All other checkers continue to run.
+
+        Defaults to :code:`0`, which means that the memory is not limited.
+        """
+
+        adaptive_table_sizing: bool = False
+        """Whether to adapt the table sizes of the decision diagram packages to the checkers and the size of the circuits.
+
+        Each checker then only allocates the tables for the kind of decision diagrams it primarily works with.
+        Small instances do not pay for initializing large tables, while large instances suffer less from collisions.
+
+        Defaults to :code:`False`, which keeps the default table sizes of the decision diagram package for all checkers.
+        """
+
+        unique_table_buckets: int = 0
+        """The number of buckets of the primary unique table (matrices or vectors, depending on the checker) of the decision diagram packages.
+
+        The remaining tables for the same kind of decision diagram are scaled accordingly.
+        The value is rounded up to the next power of two.
+
+        Defaults to :code:`0`, which means that the size is determined automatically.
+        """
+
+        compute_table_buckets: int = 0
+        """The number of buckets of the primary compute table (multiplication) of the decision diagram packages.
+
+        The remaining compute tables for the same kind of decision diagram are scaled accordingly.
+        The value is rounded up to the next power of two.
+
+        Defaults to :code:`0`, which means that the compute tables are scaled together with the unique tables.
+        """
+
+        cancellation_grace_period: float = 0.0
+        """Time (in seconds) that the checkers of a parallel check are granted to stop after a result has been determined or the timeout has been reached.
+
+        Checkers observe cancellation in between individual gate applications, but a single, very large decision diagram operation cannot be interrupted.
+        Checkers that did not stop within the grace period are abandoned, i.e., :meth:`~.EquivalenceCheckingManager.run` returns without waiting for them and their results are discarded.
+        They are waited for before the manager is run again, reset, or destroyed.
+
+        Defaults to :code:`0.0`, which means that all checkers are waited for.
+        """
+
+        reassign_idle_threads: bool = False
+        """Whether to reassign the threads freed by finished simulations in the parallel flow.
+
+        Once all simulations have been performed while the alternating checker is still running, the freed threads run additional alternating checkers with application schemes that are not in use yet.
+        Whichever alternating checker finishes first determines the result.
+        Has no effect unless the alternating checker is enabled.
+
+        Defaults to :code:`False`.
+        """
+
+        construction_segments: int = 1
+        """The number of segments each circuit is split into by the construction checker.
+
+        The functionalities of the individual segments are constructed concurrently in separate decision diagram packages and combined by a tree reduction afterwards.
+        The functionalities of both circuits are constructed at the same time, so that up to twice as many threads as segments are used.
+        In this mode, the configured construction scheme is ignored and the memory budget is only checked once the functionalities have been combined.
+
+        Defaults to :code:`1`, which constructs the functionalities gate by gate.
+        """
+
+        split_miters: bool = False
+        """Whether to split the alternating check into smaller, independent sub-miters.
+
+        Both circuits are aligned operation by operation. Wherever they differ, the differing region extends up to the next synchronization point, i.e., the next run of identical operations in both circuits.
+        Only the differing regions are checked, each by a separate alternating checker, and these checkers run concurrently on up to :attr:`nthreads` threads.
+        If all regions are equivalent, so are the circuits. Otherwise, the whole circuits are checked by a single alternating checker.
+        Circuits with ancillary qubits, different initial layouts or output permutations, or non-unitary operations are never split, and neither are checks for partial equivalence.
+
+        Defaults to :code:`False`.
+        """
+
+        zx_threads: int = 1
+        """The number of threads the ZX checker uses for simplifying the miter.
+
+        If larger than one, the matches of a simplification rule are searched for concurrently in large parts of the diagram.
+        Afterwards, a maximal set of matches whose neighbourhoods do not overlap is applied, so that no match is invalidated by another one.
+        The diagram itself is always rewritten by a single thread.
+        The additional threads are borrowed from the equivalence checking manager and count towards :attr:`nthreads`.
+
+        Defaults to :code:`1`.
+        """
+
         def __init__(self) -> None: ...
 
     class Optimizations:
@@ -250,6 +411,50 @@ class Configuration:
         alternating_scheme: ApplicationScheme
         """The :class:`.ApplicationScheme` used for the alternating checker."""
 
+        alternating_portfolio: list[ApplicationScheme]
+        """The :class:`application schemes <.ApplicationScheme>` raced against each other by the alternating checker in the parallel flow.
+
+        If more than one scheme is given, one alternating checker is started per scheme and the first one to reach a conclusion determines the result, while the others are cancelled.
+        The winning scheme is reported in the results.
+        The sequential flow only uses the :attr:`alternating_scheme`.
+
+        Defaults to an empty list, which means that only the :attr:`alternating_scheme` is used.
+        """
+
+        cancellation_window: int = 0
+        """The number of gates at the start and the end of both circuits that the alternating checker searches for pairs of identical gates before any decision diagram is constructed.
+
+        Gates only commute past each other in this search if they act on disjoint qubits.
+        Identical gates at the start of both circuits cancel each other, as do identical gates at the end of both circuits (as long as the circuits end in the same permutation).
+        Compiled circuits that share long unchanged regions with the original circuit thereby skip most of the decision diagram operations.
+
+        Defaults to :code:`0`, which disables the search.
+        """
+
+        lookahead_depth: int = 1
+        """The number of operations the :attr:`Lookahead <.ApplicationScheme.lookahead>` application scheme looks ahead before deciding which circuit to apply the next operation from.
+
+        All states that can be reached by applying up to this many operations from either circuit are considered and the first operation on the way to the smallest decision diagram is applied.
+        States that are reached by different orders of application are only computed once and remain cached across steps as long as they are still reachable.
+
+        Defaults to :code:`1`, which greedily applies the operation that results in the smaller decision diagram.
+        """
+
+        lookahead_beam_width: int = 0
+        """The maximum number of states that the :attr:`Lookahead <.ApplicationScheme.lookahead>` application scheme keeps per level of its search.
+
+        Defaults to :code:`0`, which keeps all states.
+        """
+
+        lookahead_size_estimate: bool = False
+        """Whether the :attr:`Lookahead <.ApplicationScheme.lookahead>` application scheme compares upper bounds on the sizes of the resulting decision diagrams instead of constructing them.
+
+        The size of a product of two decision diagrams is bounded by the product of their sizes, so that only the operation that is actually applied has to be multiplied.
+        This is considerably cheaper but less accurate.
+
+        Defaults to :code:`False`.
+        """
+
         profile: str
         """The :attr:`Gate Cost <.ApplicationScheme.gate_cost>` application scheme can be configured with a profile that specifies the cost of gates.
         This profile can be set via a file constructed like a lookup table.
@@ -314,6 +519,41 @@ class Configuration:
         Defaults to :code:`0`, which means that the seed is chosen non-deterministically for each program run.
         """
 
+        persistent_workers: bool = False
+        """Whether to run the simulations in the parallel flow on long-lived simulation workers.
+
+        Each worker keeps a single decision diagram package alive and processes stimuli from a shared pool of pre-drawn stimuli until none are left.
+        This avoids rebuilding the package's tables for every stimulus.
+
+        Defaults to :code:`False`.
+        """
+
+        batch_size: int = 1
+        """The number of stimuli that are simulated together by a single simulation checker.
+
+        All stimuli of a batch are carried through the circuits in lock-step so that every gate's decision diagram is only constructed once per batch.
+        This is most beneficial for wide, shallow circuits.
+
+        Defaults to :code:`1`, which simulates one stimulus at a time.
+        """
+
+        adaptive_sims: bool = False
+        """Whether to adaptively determine the number of simulations in the parallel flow.
+
+        The simulation checker starts with :attr:`initial_sims` stimuli.
+        Once all of them have been simulated, the number of stimuli is doubled (up to :attr:`max_sims`) unless the next round of simulations is not expected to finish within the remaining time budget or the most advanced of the running alternating checkers is expected to conclude before.
+        The individual decisions are recorded in the results.
+        Has no effect (apart from a warning) if :attr:`persistent_workers` is enabled, since persistent workers always process :attr:`max_sims` stimuli.
+
+        Defaults to :code:`False`.
+        """
+
+        initial_sims: int = 4
+        """The number of simulations to start with if :attr:`adaptive_sims` is enabled.
+
+        Defaults to :code:`4`.
+        """
+
         def __init__(self) -> None: ...
 
     class Parameterized:
@@ -505,3 +745,46 @@ class StateType:
     def __setstate__(self, state: int) -> None: ...
     @property
     def value(self) -> int: ...
+
+class GarbageCollectionPolicy:
+    """The policy that determines when garbage is collected in the decision diagram packages while applying gates.
+
+    Garbage collection frees nodes that are no longer referenced, but also clears the compute tables.
+    Collecting less frequently thus increases throughput at the cost of a higher peak memory usage.
+    """
+
+    always: ClassVar[GarbageCollectionPolicy] = ...
+    """Ask the package to collect garbage after every gate. The package itself decides whether a collection pays off."""
+
+    periodic: ClassVar[GarbageCollectionPolicy] = ...
+    """Collect garbage every :attr:`~.Configuration.Execution.gc_interval` gates."""
+
+    load_factor: ClassVar[GarbageCollectionPolicy] = ...
+    """Collect garbage whenever the unique tables hold more than :attr:`~.Configuration.Execution.gc_load_factor` entries per bucket."""
+
+    high_water_mark: ClassVar[GarbageCollectionPolicy] = ...
+    """Collect garbage whenever the estimated memory of the nodes and compute tables exceeds :attr:`~.Configuration.Execution.gc_high_water_mark` MiB."""
+
+    adaptive: ClassVar[GarbageCollectionPolicy] = ...
+    """Adapt the collection interval based on how many nodes the previous collection freed."""
+
+    __members__: ClassVar[dict[GarbageCollectionPolicy, int]] = ...  # read-only
+
+    @overload
+    def __init__(self, value: int) -> None: ...
+    @overload
+    def __init__(
+        self, policy: Literal["always", "periodic", "load_factor", "high_water_mark", "adaptive"]
+    ) -> None: ...
+    @overload
+    def __init__(self, policy: str) -> None: ...
+    def name(self) -> str: ...
+    def __eq__(self, other: object) -> bool: ...
+    def __getstate__(self) -> int: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: object) -> bool: ...
+    def __setstate__(self, state: int) -> None: ...
+    @property
+    def value(self) -> int: ...
@@ -10,16 +10,17 @@
 
 from __future__ import annotations
 
-from typing import TYPE_CHECKING
+from typing import TYPE_CHECKING, cast
 
 from mqt.core import load
 
 from .configuration import augment_config_from_kwargs
 from .parameterized import check_parameterized
-from .pyqcec import Configuration, EquivalenceCheckingManager
+from .pyqcec import BatchEquivalenceChecker, Configuration, EquivalenceCheckingManager
 
 if TYPE_CHECKING:
     import os
+    from collections.abc import Callable, Iterable
 
     from mqt.core.ir import QuantumComputation
     from qiskit.circuit import QuantumCircuit
@@ -27,7 +28,7 @@ if TYPE_CHECKING:
     from ._compat.typing import Unpack
     from .configuration import ConfigurationOptions
 
-__all__ = ["verify"]
+__all__ = ["verify", "verify_batch"]
 
 
 def __dir__() -> list[str]:
@@ -83,3 +84,65 @@ def verify(
 
     # obtain the result
     return ecm.results
+
+
+def verify_batch(
+    pairs: Iterable[
+        tuple[
+            QuantumComputation | str | os.PathLike[str] | QuantumCircuit,
+            QuantumComputation | str | os.PathLike[str] | QuantumCircuit,
+        ]
+    ],
+    configuration: Configuration | None = None,
+    callback: Callable[[int, EquivalenceCheckingManager.Results], None] | None = None,
+    **kwargs: Unpack[ConfigurationOptions],
+) -> list[EquivalenceCheckingManager.Results]:
+    """Verify that the circuits of each pair in ``pairs`` are equivalent.
+
+    In contrast to calling :func:`verify` for every pair, all checks share a budget of
+    :attr:`~.Configuration.Execution.nthreads` busy threads via a :class:`.BatchEquivalenceChecker`.
+    The configuration is handled in the same way as in :func:`verify` and applies to all pairs.
+
+    Args:
+        pairs: The pairs of circuits to check.
+        configuration: The configuration to use for the equivalence checking process.
+        callback: Called with the index of a pair and its results as soon as the pair has been checked.
+        **kwargs: Keyword arguments to configure the equivalence checking process.
+
+    Returns:
+        The results of the equivalence checking process for each pair (in the order of ``pairs``).
+    """
+    if configuration is None:
+        configuration = Configuration()
+
+    # prepare the configuration
+    augment_config_from_kwargs(configuration, kwargs)
+
+    results: list[EquivalenceCheckingManager.Results | None] = []
+    batch = BatchEquivalenceChecker(configuration)
+    # maps the indices within the batch to the indices within `pairs`
+    indices: list[int] = []
+    for circ1, circ2 in pairs:
+        qc1 = load(circ1)
+        qc2 = load(circ2)
+        index = len(results)
+        results.append(None)
+        if not qc1.is_variable_free() or not qc2.is_variable_free():
+            results[index] = check_parameterized(qc1, qc2, configuration)
+            if callback is not None:
+                callback(index, results[index])
+            continue
+        batch.add_pair(qc1, qc2)
+        indices.append(index)
+
+    def forward(batch_index: int, batch_results: EquivalenceCheckingManager.Results) -> None:
+        assert callback is not None
+        callback(indices[batch_index], batch_results)
+
+    # execute the checks
+    batch.run(forward if callback is not None else None)
+
+    for batch_index, index in enumerate(indices):
+        results[index] = batch.results(batch_index)
+    return cast("list[EquivalenceCheckingManager.Results]", results)
+
@@ -8,17 +8,21 @@
  * Licensed under the MIT License
  */
 
+#include "BatchEquivalenceChecker.hpp"
 #include "Configuration.hpp"
 #include "EquivalenceCheckingManager.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "checker/dd/GarbageCollectionPolicy.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/simulation/StateType.hpp"
 #include "dd/RealNumber.hpp"
 #include "ir/QuantumComputation.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <exception>
 #include <memory>
+#include <pybind11/functional.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11_json/pybind11_json.hpp>
@@ -78,6 +82,26 @@ PYBIND11_MODULE(pyqcec, m, py::mod_gil_not_used()) {
   // allow implicit conversion from string to StateType
   py::implicitly_convertible<std::string, StateType>();
 
+  // Garbage collection policy enum
+  py::enum_<GarbageCollectionPolicy>(m, "GarbageCollectionPolicy")
+      .value("always", GarbageCollectionPolicy::Always)
+      .value("periodic", GarbageCollectionPolicy::Periodic)
+      .value("load_factor", GarbageCollectionPolicy::LoadFactor)
+      .value("high_water_mark", GarbageCollectionPolicy::HighWaterMark)
+      .value("adaptive", GarbageCollectionPolicy::Adaptive)
+      // allow construction from a string
+      .def(py::init([](const std::string& str) -> GarbageCollectionPolicy {
+             return garbageCollectionPolicyFromString(str);
+           }),
+           "policy"_a)
+      // provide a string representation of the enum
+      .def(
+          "__str__",
+          [](const GarbageCollectionPolicy policy) { return toString(policy); },
+          py::prepend());
+  // allow implicit conversion from string to GarbageCollectionPolicy
+  py::implicitly_convertible<std::string, GarbageCollectionPolicy>();
+
   // Equivalence criterion enum
   py::enum_<EquivalenceCriterion>(m, "EquivalenceCriterion")
       .value("no_information", EquivalenceCriterion::NoInformation)
@@ -109,9 +133,14 @@ PYBIND11_MODULE(pyqcec, m, py::mod_gil_not_used()) {
   py::class_<Configuration> configuration(m, "Configuration");
 
   // Constructors
+  // Both the constructor (which runs all optimization passes) and `run` may
+  // take a while and do not touch any Python objects. Hence, they release the
+  // GIL so that other Python threads (e.g., further managers) can run
+  // concurrently.
   ecm.def(py::init<const qc::QuantumComputation&, const qc::QuantumComputation&,
                    Configuration>(),
-          "circ1"_a, "circ2"_a, "config"_a = Configuration());
+          "circ1"_a, "circ2"_a, "config"_a = Configuration(),
+          py::call_guard<py::gil_scoped_release>());
 
   // Access to circuits
   ecm.def_property_readonly("qc1",
@@ -127,7 +156,8 @@ PYBIND11_MODULE(pyqcec, m, py::mod_gil_not_used()) {
       });
 
   // Run
-  ecm.def("run", &EquivalenceCheckingManager::run);
+  ecm.def("run", &EquivalenceCheckingManager::run,
+          py::call_guard<py::gil_scoped_release>());
 
   // Results
   ecm.def_property_readonly("results", &EquivalenceCheckingManager::getResults);
@@ -162,6 +192,8 @@ PYBIND11_MODULE(pyqcec, m, py::mod_gil_not_used()) {
                      &EquivalenceCheckingManager::Results::startedSimulations)
       .def_readwrite("performed_simulations",
                      &EquivalenceCheckingManager::Results::performedSimulations)
+      .def_readwrite("simulations_aborted",
+                     &EquivalenceCheckingManager::Results::simulationsAborted)
       .def_readwrite("cex_input",
                      &EquivalenceCheckingManager::Results::cexInput)
       .def_readwrite("cex_output1",
@@ -182,6 +214,29 @@ PYBIND11_MODULE(pyqcec, m, py::mod_gil_not_used()) {
                toString(res.equivalence) + ">";
       });
 
+  // BatchEquivalenceChecker bindings
+  py::class_<BatchEquivalenceChecker> batch(m, "BatchEquivalenceChecker");
+  batch.def(py::init<Configuration>(), "config"_a = Configuration())
+      // the circuits are referenced by the batch and need to stay alive
+      .def("add_pair", &BatchEquivalenceChecker::addPair, "circ1"_a, "circ2"_a,
+           py::keep_alive<1, 2>(), py::keep_alive<1, 3>())
+      .def("run", &BatchEquivalenceChecker::run, "callback"_a = nullptr,
+           py::call_guard<py::gil_scoped_release>())
+      .def("clear", &BatchEquivalenceChecker::clear)
+      .def("__len__", &BatchEquivalenceChecker::size)
+      .def(
+          "results",
+          [](const BatchEquivalenceChecker& checker, const std::size_t index)
+              -> const EquivalenceCheckingManager::Results& {
+            return checker.getResults(index);
+          },
+          "index"_a, py::return_value_policy::reference_internal)
+      .def_property(
+          "configuration", &BatchEquivalenceChecker::getConfiguration,
+          [](BatchEquivalenceChecker& checker, const Configuration& config) {
+            checker.getConfiguration() = config;
+          });
+
   // Configuration sub-classes
   py::class_<Configuration::Execution> execution(configuration, "Execution");
   py::class_<Configuration::Optimizations> optimizations(configuration,
@@ -218,7 +273,30 @@ PYBIND11_MODULE(pyqcec, m, py::mod_gil_not_used()) {
                      &Configuration::Execution::runAlternatingChecker)
       .def_readwrite("run_zx_checker", &Configuration::Execution::runZXChecker)
       .def_readwrite("numerical_tolerance",
-                     &Configuration::Execution::numericalTolerance);
+                     &Configuration::Execution::numericalTolerance)
+      .def_readwrite("gate_cache_size",
+                     &Configuration::Execution::gateCacheSize)
+      .def_readwrite("gc_policy", &Configuration::Execution::gcPolicy)
+      .def_readwrite("gc_interval", &Configuration::Execution::gcInterval)
+      .def_readwrite("gc_load_factor",
+                     &Configuration::Execution::gcLoadFactor)
+      .def_readwrite("gc_high_water_mark",
+                     &Configuration::Execution::gcHighWaterMark)
+      .def_readwrite("memory_budget", &Configuration::Execution::memoryBudget)
+      .def_readwrite("adaptive_table_sizing",
+                     &Configuration::Execution::adaptiveTableSizing)
+      .def_readwrite("unique_table_buckets",
+                     &Configuration::Execution::uniqueTableBuckets)
+      .def_readwrite("compute_table_buckets",
+                     &Configuration::Execution::computeTableBuckets)
+      .def_readwrite("cancellation_grace_period",
+                     &Configuration::Execution::cancellationGracePeriod)
+      .def_readwrite("reassign_idle_threads",
+                     &Configuration::Execution::reassignIdleThreads)
+      .def_readwrite("construction_segments",
+                     &Configuration::Execution::constructionSegments)
+      .def_readwrite("split_miters", &Configuration::Execution::splitMiters)
+      .def_readwrite("zx_threads", &Configuration::Execution::zxThreads);
 
   // optimization options
   optimizations.def(py::init<>())
@@ -247,6 +325,16 @@ PYBIND11_MODULE(pyqcec, m, py::mod_gil_not_used()) {
                      &Configuration::Application::simulationScheme)
       .def_readwrite("alternating_scheme",
                      &Configuration::Application::alternatingScheme)
+      .def_readwrite("alternating_portfolio",
+                     &Configuration::Application::alternatingPortfolio)
+      .def_readwrite("cancellation_window",
+                     &Configuration::Application::cancellationWindow)
+      .def_readwrite("lookahead_depth",
+                     &Configuration::Application::lookaheadDepth)
+      .def_readwrite("lookahead_beam_width",
+                     &Configuration::Application::lookaheadBeamWidth)
+      .def_readwrite("lookahead_size_estimate",
+                     &Configuration::Application::lookaheadSizeEstimate)
       .def_readwrite("profile", &Configuration::Application::profile);
 
   // functionality options
@@ -262,7 +350,12 @@ PYBIND11_MODULE(pyqcec, m, py::mod_gil_not_used()) {
                      &Configuration::Simulation::fidelityThreshold)
       .def_readwrite("max_sims", &Configuration::Simulation::maxSims)
       .def_readwrite("state_type", &Configuration::Simulation::stateType)
-      .def_readwrite("seed", &Configuration::Simulation::seed);
+      .def_readwrite("seed", &Configuration::Simulation::seed)
+      .def_readwrite("persistent_workers",
+                     &Configuration::Simulation::persistentWorkers)
+      .def_readwrite("batch_size", &Configuration::Simulation::batchSize)
+      .def_readwrite("adaptive_sims", &Configuration::Simulation::adaptiveSims)
+      .def_readwrite("initial_sims", &Configuration::Simulation::initialSims);
 
   // parameterized options
   parameterized.def(py::init<>())
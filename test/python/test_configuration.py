@@ -12,7 +12,7 @@ from __future__ import annotations
 
 import pytest
 
-from mqt.qcec.pyqcec import ApplicationScheme, Configuration, StateType
+from mqt.qcec.pyqcec import ApplicationScheme, Configuration, GarbageCollectionPolicy, StateType
 
 
 @pytest.mark.parametrize(
@@ -63,3 +63,34 @@ def test_state_type(state_type_string: str, state_type_enum: StateType) -> None:
 
     config = Configuration()
     config.simulation.state_type = state_type_enum
+
+
+@pytest.mark.parametrize(
+    ("policy_string", "policy_enum"),
+    [
+        ("always", GarbageCollectionPolicy.always),
+        ("periodic", GarbageCollectionPolicy.periodic),
+        ("load_factor", GarbageCollectionPolicy.load_factor),
+        ("high_water_mark", GarbageCollectionPolicy.high_water_mark),
+        ("adaptive", GarbageCollectionPolicy.adaptive),
+    ],
+)
+def test_garbage_collection_policy(policy_string: str, policy_enum: GarbageCollectionPolicy) -> None:
+    """Test the garbage collection policy enum."""
+    assert GarbageCollectionPolicy(policy_string) == policy_enum
+
+    config = Configuration()
+    config.execution.gc_policy = policy_enum
+    config.execution.gc_policy = policy_string  # type: ignore[assignment]
+
+
+def test_alternating_portfolio() -> None:
+    """Test configuring a portfolio of application schemes for the alternating checker."""
+    config = Configuration()
+    assert config.application.alternating_portfolio == []
+
+    config.application.alternating_portfolio = [ApplicationScheme.proportional, ApplicationScheme.lookahead]
+    assert config.application.alternating_portfolio == [ApplicationScheme.proportional, ApplicationScheme.lookahead]
+
+    config.application.alternating_portfolio = ["one_to_one", "lookahead"]  # type: ignore[list-item]
+    assert config.application.alternating_portfolio == [ApplicationScheme.one_to_one, ApplicationScheme.lookahead]
@@ -10,10 +10,12 @@
 
 from __future__ import annotations
 
+from concurrent.futures import ThreadPoolExecutor
+
 import pytest
 from qiskit import QuantumCircuit, transpile
 
-from mqt.qcec import verify
+from mqt.qcec import verify, verify_batch
 from mqt.qcec.pyqcec import ApplicationScheme, Configuration, EquivalenceCriterion
 
 
@@ -102,3 +104,42 @@ def test_cpp_exception_propagation_internal() -> None:
 
     with pytest.raises(ValueError, match=r"Lookahead application scheme can only be used for matrices."):
         verify(qc, qc, configuration=config)
+
+
+def test_verify_concurrently(original_circuit: QuantumCircuit, alternative_circuit: QuantumCircuit) -> None:
+    """Test that multiple verifications can be run concurrently from separate Python threads."""
+    non_equivalent_circuit = QuantumCircuit(3)
+    non_equivalent_circuit.h(0)
+    non_equivalent_circuit.cx(0, 1)
+    non_equivalent_circuit.x(2)
+    non_equivalent_circuit.measure_all()
+
+    pairs = [(original_circuit, alternative_circuit), (original_circuit, non_equivalent_circuit)] * 4
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        results = list(executor.map(lambda pair: verify(*pair), pairs))
+
+    for (_, circuit), result in zip(pairs, results):
+        if circuit is alternative_circuit:
+            assert result.equivalence == EquivalenceCriterion.equivalent
+        else:
+            assert result.equivalence == EquivalenceCriterion.not_equivalent
+
+
+def test_verify_batch(original_circuit: QuantumCircuit, alternative_circuit: QuantumCircuit) -> None:
+    """Test the verification of a batch of circuit pairs."""
+    non_equivalent_circuit = QuantumCircuit(3)
+    non_equivalent_circuit.h(0)
+    non_equivalent_circuit.cx(0, 1)
+    non_equivalent_circuit.x(2)
+    non_equivalent_circuit.measure_all()
+
+    pairs = [(original_circuit, alternative_circuit), (original_circuit, non_equivalent_circuit)] * 4
+    reported: list[int] = []
+    results = verify_batch(pairs, callback=lambda index, _: reported.append(index), nthreads=2)
+
+    assert sorted(reported) == list(range(len(pairs)))
+    for index, result in enumerate(results):
+        if index % 2 == 0:
+            assert result.equivalence == EquivalenceCriterion.equivalent
+        else:
+            assert result.equivalence == EquivalenceCriterion.not_equivalent
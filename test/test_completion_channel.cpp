@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CompletionChannel.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+TEST(CompletionChannel, ConcurrentProducers) {
+  constexpr std::size_t producers = 4U;
+  constexpr std::size_t valuesPerProducer = 1000U;
+  // a tiny capacity forces producers to wait for the consumer
+  ec::CompletionChannel<std::size_t> channel(3U);
+  EXPECT_EQ(channel.capacity(), 4U);
+  EXPECT_FALSE(channel.tryPop());
+  EXPECT_FALSE(channel.waitAndPopUntil(std::chrono::steady_clock::now() +
+                                       std::chrono::milliseconds(10)));
+
+  std::vector<std::thread> threads{};
+  for (std::size_t i = 0U; i < producers; ++i) {
+    threads.emplace_back([&channel, i] {
+      for (std::size_t j = 0U; j < valuesPerProducer; ++j) {
+        channel.push((i * valuesPerProducer) + j);
+      }
+    });
+  }
+
+  std::vector<bool> received(producers * valuesPerProducer, false);
+  for (std::size_t i = 0U; i < producers * valuesPerProducer; ++i) {
+    const auto value = i % 2U == 0U
+                           ? channel.waitAndPop()
+                           : channel
+                                 .waitAndPopUntil(
+                                     std::chrono::steady_clock::now() +
+                                     std::chrono::seconds(10))
+                                 .value();
+    EXPECT_FALSE(received.at(value));
+    received.at(value) = true;
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_FALSE(channel.tryPop());
+}
@@ -8,17 +8,40 @@
  * Licensed under the MIT License
  */
 
+#include "BatchEquivalenceChecker.hpp"
+#include "Configuration.hpp"
 #include "EquivalenceCheckingManager.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "NumericalToleranceLock.hpp"
+#include "StopToken.hpp"
+#include "checker/dd/DDPackageConfigs.hpp"
+#include "checker/dd/GarbageCollector.hpp"
+#include "checker/dd/GateCancellation.hpp"
+#include "checker/dd/MiterSplittingChecker.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "dd/ComplexNumbers.hpp"
 #include "dd/DDDefinitions.hpp"
+#include "dd/DDpackageConfig.hpp"
+#include "dd/RealNumber.hpp"
+#include "ir/Definitions.hpp"
 #include "ir/operations/Control.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <functional>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 class EqualityTest : public testing::Test {
   void SetUp() override {
@@ -31,13 +54,54 @@ class EqualityTest : public testing::Test {
     config.execution.runZXChecker = false;
   }
 
+  void TearDown() override {
+    // some tests change the process-wide numerical tolerance
+    dd::ComplexNumbers::setTolerance(defaultTolerance);
+  }
+
 protected:
+  dd::fp defaultTolerance = dd::RealNumber::eps;
   std::size_t nqubits = 1U;
   qc::QuantumComputation qc1;
   qc::QuantumComputation qc2;
   ec::Configuration config{};
 };
 
+namespace {
+// the quantum Fourier transform (without the final swaps). Since controlled
+// phase gates are symmetric, the orientation of their controls can be flipped
+// to obtain an equivalent circuit that is structurally different.
+qc::QuantumComputation qft(const std::size_t nqubits,
+                           const bool flipControls = false) {
+  auto qc = qc::QuantumComputation(nqubits);
+  for (std::size_t i = 0U; i < nqubits; ++i) {
+    const auto target = static_cast<qc::Qubit>(i);
+    qc.h(target);
+    for (std::size_t j = i + 1U; j < nqubits; ++j) {
+      const auto control = static_cast<qc::Qubit>(j);
+      const auto lambda = dd::PI / static_cast<dd::fp>(1U << (j - i));
+      if (flipControls) {
+        qc.cp(lambda, target, control);
+      } else {
+        qc.cp(lambda, control, target);
+      }
+    }
+  }
+  return qc;
+}
+
+// a manager whose tasks can be intercepted right before their checker runs
+class HookedManager : public ec::EquivalenceCheckingManager {
+public:
+  using EquivalenceCheckingManager::EquivalenceCheckingManager;
+
+  void
+  setTaskHook(std::function<void(std::size_t, const ec::StopToken&)> hook) {
+    taskHook = std::move(hook);
+  }
+};
+} // namespace
+
 TEST_F(EqualityTest, NothingToDo) {
   qc1.x(0);
   qc2.x(0);
@@ -227,6 +291,602 @@ TEST_F(EqualityTest, ExceptionInParallelThread) {
   EXPECT_THROW(ecm.run(), std::invalid_argument);
 }
 
+TEST_F(EqualityTest, MemoryBudgetExceeded) {
+  // the decision diagram of the QFT grows exponentially with the number of
+  // qubits, which quickly exceeds a budget that leaves only a single MiB for
+  // the nodes (on top of the compute tables)
+  qc1 = qft(10U);
+
+  config.execution.runConstructionChecker = true;
+  config.execution.runSimulationChecker = true;
+  constexpr std::size_t mib = 1024U * 1024U;
+  config.execution.memoryBudget =
+      (ec::GarbageCollector::computeTableMemory(dd::DDPackageConfig{}) / mib) +
+      2U;
+
+  for (const bool parallel : {false, true}) {
+    config.execution.parallel = parallel;
+    ec::EquivalenceCheckingManager ecm(qc1, qc1, config);
+    ecm.run();
+
+    // the construction checker gives up, but the simulations still complete
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+    const auto& results = ecm.getResults();
+    EXPECT_EQ(results.performedSimulations, config.simulation.maxSims);
+    bool aborted = false;
+    for (const auto& checker : results.checkerResults) {
+      if (checker.contains("abort_reason")) {
+        aborted = true;
+        EXPECT_EQ(checker["equivalence"], "no_information");
+      }
+    }
+    EXPECT_TRUE(aborted);
+    EXPECT_FALSE(results.simulationsAborted);
+  }
+
+  // the compute tables alone exceed the smallest possible budget, so that the
+  // first simulation gives up as well. Both flows then stop simulating.
+  config.execution.memoryBudget = 1U;
+  config.execution.nthreads = 4U;
+  for (const bool parallel : {false, true}) {
+    config.execution.parallel = parallel;
+    ec::EquivalenceCheckingManager ecm(qc1, qc1, config);
+    ecm.run();
+
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NoInformation);
+    const auto& results = ecm.getResults();
+    EXPECT_TRUE(results.simulationsAborted);
+    EXPECT_EQ(results.performedSimulations, 0U);
+    EXPECT_LE(results.startedSimulations, config.execution.nthreads);
+    EXPECT_TRUE(results.json()["simulations"]["aborted"].get<bool>());
+  }
+}
+
+TEST_F(EqualityTest, MemoryBudgetExceededBeforeZXChecker) {
+  // the ancillary qubit keeps the ZX checker from concluding anything about
+  // the (non-equivalent) circuits. Since it is only acted on in one of the
+  // circuits, the alternating checker can still be used.
+  constexpr std::size_t n = 10U;
+  qc1 = qft(n);
+  qc1.addAncillaryQubit(n, std::nullopt);
+  qc1.x(static_cast<qc::Qubit>(n));
+  qc2 = qc::QuantumComputation(n);
+  qc2.addAncillaryQubit(n, std::nullopt);
+
+  config.execution.runAlternatingChecker = true;
+  config.execution.runZXChecker = true;
+  config.execution.parallel = false;
+  config.execution.memoryBudget = 1U;
+
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+
+  // the alternating checker gives up, so that no checker provides a result
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NoInformation);
+  const auto& checkers = ecm.getResults().checkerResults;
+  ASSERT_EQ(checkers.size(), 2U);
+  EXPECT_TRUE(checkers[0].contains("abort_reason"));
+  EXPECT_EQ(checkers[1]["checker"], "zx");
+  EXPECT_EQ(checkers[1]["equivalence"], "no_information");
+}
+
+TEST_F(EqualityTest, AdaptiveStimulusCount) {
+  constexpr std::size_t n = 4U;
+  qc1 = qc::QuantumComputation(n);
+  for (std::size_t i = 0U; i < n; ++i) {
+    qc1.h(static_cast<qc::Qubit>(i));
+  }
+  qc1.cx(0, 1);
+  qc1.cx(2, 3);
+
+  config.execution.runSimulationChecker = true;
+  config.execution.nthreads = 4U;
+  config.simulation.maxSims = 16U;
+  config.simulation.adaptiveSims = true;
+  config.simulation.initialSims = 2U;
+
+  ec::EquivalenceCheckingManager ecm(qc1, qc1, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+
+  // without other checkers and a timeout, the number of stimuli is doubled
+  // until the maximum is reached
+  const auto& results = ecm.getResults();
+  EXPECT_EQ(results.performedSimulations, config.simulation.maxSims);
+  const auto& decisions = results.simulationDecisions;
+  ASSERT_EQ(decisions.size(), 4U);
+  for (std::size_t i = 0U; i < 3U; ++i) {
+    EXPECT_EQ(decisions[i]["decision"], "grow");
+    EXPECT_EQ(decisions[i]["limit"], 4U << i);
+  }
+  EXPECT_EQ(decisions[3]["decision"], "stop");
+  EXPECT_EQ(decisions[3]["reason"], "max_sims");
+  EXPECT_TRUE(results.json()["simulations"].contains("decisions"));
+}
+
+TEST_F(EqualityTest, ReassignIdleThreads) {
+  // two equivalent QFT circuits that differ in the orientation of the
+  // controlled phase gates
+  qc1 = qft(8U);
+  qc2 = qft(8U, true);
+
+  config.execution.runAlternatingChecker = true;
+  config.execution.runSimulationChecker = true;
+  config.execution.reassignIdleThreads = true;
+  config.execution.nthreads = 4U;
+  config.simulation.maxSims = 2U;
+  config.application.alternatingScheme = ec::ApplicationSchemeType::Sequential;
+  // only ends the test (instead of hanging) if no checker is reassigned
+  config.execution.timeout = 60.;
+
+  // the first alternating checker (first slot) is held until the check is
+  // done, so only an alternating checker started in a slot freed by a
+  // simulation can conclude equivalence
+  std::mutex mutex{};
+  std::vector<std::size_t> tasks(3U, 0U);
+  HookedManager ecm(qc1, qc2, config);
+  ecm.setTaskHook([&](const std::size_t slot, const ec::StopToken& token) {
+    {
+      const std::lock_guard lock(mutex);
+      ++tasks.at(slot);
+    }
+    if (slot == 0U) {
+      while (!token.stopRequested()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+  });
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  // a simulation slot has been reused for a second task
+  EXPECT_EQ(tasks[0], 1U);
+  EXPECT_EQ(std::max(tasks[1], tasks[2]), 2U);
+
+  // the deciding alternating checker uses another application scheme than
+  // the held one, and every alternating checker uses a different one
+  std::vector<std::string> schemes{};
+  for (const auto& checker : ecm.getResults().checkerResults) {
+    if (checker["checker"] == "decision_diagram_alternating") {
+      const auto scheme = checker["application_scheme"].get<std::string>();
+      EXPECT_EQ(std::count(schemes.begin(), schemes.end(), scheme), 0);
+      schemes.emplace_back(scheme);
+    }
+  }
+  ASSERT_FALSE(schemes.empty());
+  EXPECT_NE(std::find(schemes.begin(), schemes.end(), "proportional"),
+            schemes.end());
+}
+
+TEST_F(EqualityTest, AlternatingPortfolio) {
+  qc1 = qft(6U);
+  qc2 = qft(6U, true);
+
+  config.execution.runAlternatingChecker = true;
+  config.execution.nthreads = 3U;
+  config.application.alternatingPortfolio = {
+      ec::ApplicationSchemeType::Sequential,
+      ec::ApplicationSchemeType::Proportional,
+      ec::ApplicationSchemeType::Lookahead,
+      ec::ApplicationSchemeType::Proportional};
+  EXPECT_FALSE(config.onlySingleTask());
+
+  // with split miters, the configured scheme runs as a miter splitting checker
+  for (const bool splitMiters : {false, true}) {
+    config.execution.splitMiters = splitMiters;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+    // duplicate schemes are only raced once
+    const auto json = ecm.getResults().json();
+    ASSERT_TRUE(json.contains("alternating_portfolio"));
+    const auto& portfolio = json["alternating_portfolio"];
+    EXPECT_EQ(portfolio["schemes"].size(), 3U);
+    const auto winner = portfolio["winner"].get<std::string>();
+    EXPECT_TRUE(winner == "sequential" || winner == "proportional" ||
+                winner == "lookahead");
+  }
+}
+
+TEST_F(EqualityTest, AlternatingPortfolioWithOtherCheckers) {
+  qc1 = qc::QuantumComputation(3U);
+  qc1.h(0);
+  qc1.cx(0, 1);
+  qc1.cx(0, 2);
+  qc2 = qc::QuantumComputation(3U);
+  qc2.h(0);
+  qc2.cx(0, 2);
+  qc2.cx(0, 1);
+
+  config.execution.runAlternatingChecker = true;
+  config.execution.runConstructionChecker = true;
+  config.execution.runZXChecker = true;
+  config.application.alternatingPortfolio = {
+      ec::ApplicationSchemeType::Sequential,
+      ec::ApplicationSchemeType::Proportional,
+      ec::ApplicationSchemeType::Lookahead};
+
+  // fewer threads than schemes in the portfolio: the construction and the ZX
+  // checker must not be started beyond the available slots
+  for (const auto nthreads : {2U, 3U}) {
+    config.execution.nthreads = nthreads;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+    EXPECT_LE(ecm.getResults().checkerResults.size(), nthreads);
+  }
+}
+
+TEST_F(EqualityTest, CancellationGracePeriod) {
+  qc1.h(0);
+  qc2.h(0);
+  config.execution.runAlternatingChecker = true;
+  config.execution.runConstructionChecker = true;
+  config.execution.nthreads = 2U;
+  config.execution.cancellationGracePeriod = 0.01;
+
+  // the construction checker (second slot) does not react to the cancellation
+  // until it is released, while the alternating checker (first slot) only
+  // starts once the construction checker is stuck
+  std::mutex mutex{};
+  std::condition_variable cond{};
+  bool stuck = false;
+  bool released = false;
+  bool finished = false;
+  bool stopObserved = false;
+  HookedManager ecm(qc1, qc2, config);
+  ecm.setTaskHook([&](const std::size_t slot, const ec::StopToken& token) {
+    std::unique_lock lock(mutex);
+    if (slot == 0U) {
+      cond.wait(lock, [&stuck] { return stuck; });
+      return;
+    }
+    stuck = true;
+    cond.notify_all();
+    cond.wait(lock, [&released] { return released; });
+    stopObserved = token.stopRequested();
+    finished = true;
+  });
+
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  // the stuck checker has been abandoned and is not part of the results
+  EXPECT_EQ(ecm.getResults().checkerResults.size(), 1U);
+  {
+    const std::lock_guard lock(mutex);
+    EXPECT_FALSE(finished);
+    released = true;
+  }
+  cond.notify_all();
+
+  // abandoned checkers are waited for before the manager is reset
+  ecm.reset();
+  EXPECT_TRUE(finished);
+  EXPECT_TRUE(stopObserved);
+
+  // afterwards, the manager can be run again
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(EqualityTest, AdaptivePackageTableSizing) {
+  const ec::ConstructionDDPackageConfig defaults{};
+  ec::Configuration::Execution execution{};
+  execution.adaptiveTableSizing = true;
+
+  // small instances get small tables, disabled tables stay disabled
+  auto small = ec::adaptPackageConfig(defaults, true, 5U, 20U, execution);
+  EXPECT_LT(small.utMatNumBucket, defaults.utMatNumBucket);
+  EXPECT_LT(small.ctMatMatMultNumBucket, defaults.ctMatMatMultNumBucket);
+  EXPECT_EQ(small.utVecNumBucket, 1U);
+
+  // large instances get larger tables
+  const auto large =
+      ec::adaptPackageConfig(defaults, true, 60U, 100'000U, execution);
+  EXPECT_GT(large.utMatNumBucket, defaults.utMatNumBucket);
+
+  // explicit bucket counts take precedence and are rounded to a power of two
+  execution.uniqueTableBuckets = 3'000U;
+  execution.computeTableBuckets = 512U;
+  small = ec::adaptPackageConfig(defaults, true, 5U, 20U, execution);
+  EXPECT_EQ(small.utMatNumBucket, 4'096U);
+  EXPECT_EQ(small.ctMatMatMultNumBucket, 512U);
+
+  // adaptive sizing is opt-in, without it every checker keeps the default
+  // tables of the package
+  execution = ec::Configuration::Execution{};
+  const dd::DDPackageConfig packageDefaults{};
+  const auto unchanged =
+      ec::adaptPackageConfig(defaults, true, 5U, 20U, execution);
+  EXPECT_EQ(unchanged.utMatNumBucket, packageDefaults.utMatNumBucket);
+  EXPECT_EQ(unchanged.utVecNumBucket, packageDefaults.utVecNumBucket);
+  EXPECT_EQ(unchanged.ctMatVecMultNumBucket,
+            packageDefaults.ctMatVecMultNumBucket);
+
+  qc1.x(0);
+  qc2.x(0);
+  config.execution.runConstructionChecker = true;
+  config.execution.uniqueTableBuckets = 2'048U;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getResults().checkerResults[0]["unique_table_buckets"],
+            2'048U);
+}
+
+TEST_F(EqualityTest, SegmentedConstruction) {
+  qc1 = qc::QuantumComputation(4U);
+  qc1.h(0);
+  qc1.cx(0, 1);
+  qc1.swap(1, 2);
+  qc1.mcx({0, 2}, 3);
+  qc1.t(3);
+  qc1.cx(3, 1);
+  qc1.swap(0, 3);
+  qc1.h(2);
+  qc1.cx(2, 0);
+
+  // the same circuit with additional gates that cancel each other
+  qc2 = qc::QuantumComputation(4U);
+  qc2.h(0);
+  qc2.cx(0, 1);
+  qc2.x(2);
+  qc2.x(2);
+  qc2.swap(1, 2);
+  qc2.mcx({0, 2}, 3);
+  qc2.t(3);
+  qc2.cx(3, 1);
+  qc2.h(1);
+  qc2.h(1);
+  qc2.swap(0, 3);
+  qc2.h(2);
+  qc2.cx(2, 0);
+
+  config.execution.runConstructionChecker = true;
+  config.optimizations.fuseSingleQubitGates = false;
+  config.optimizations.reconstructSWAPs = false;
+  for (const auto segments : {1U, 2U, 3U, 16U}) {
+    config.execution.constructionSegments = segments;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent)
+        << "segments: " << segments;
+  }
+
+  qc2.t(1);
+  config.execution.constructionSegments = 4U;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(EqualityTest, StructuralGateCancellation) {
+  qc1 = qc::QuantumComputation(3U);
+  qc1.h(0);
+  qc1.cx(0, 1);
+  qc1.t(1);
+  qc1.cx(1, 2);
+  qc1.h(2);
+
+  qc2 = qc::QuantumComputation(3U);
+  qc2.cx(0, 1);
+  qc2.h(0);
+  qc2.s(1);
+  qc2.cx(1, 2);
+  qc2.h(2);
+
+  // the first CNOT does not commute with the Hadamard gate
+  auto cancelled = ec::cancelGates(qc1, qc2, 8U, {}, true);
+  EXPECT_EQ(cancelled.prefix, 0U);
+  EXPECT_EQ(cancelled.suffix, 2U);
+
+  // the Hadamard gates on different qubits commute
+  qc2 = qc::QuantumComputation(3U);
+  qc2.h(2);
+  qc2.h(0);
+  qc2.cx(0, 1);
+  qc2.s(1);
+  qc2.cx(1, 2);
+  qc2.h(2);
+  qc2.h(2);
+  cancelled = ec::cancelGates(qc1, qc2, 8U, {}, true);
+  EXPECT_EQ(cancelled.prefix, 2U);
+  EXPECT_EQ(cancelled.suffix, 1U);
+  EXPECT_EQ(cancelled.first,
+            std::vector<bool>({true, true, false, false, true}));
+  EXPECT_EQ(cancelled.second,
+            std::vector<bool>({false, true, true, false, false, false, true}));
+
+  // without a window, nothing is cancelled
+  cancelled = ec::cancelGates(qc1, qc2, 0U, {}, true);
+  EXPECT_EQ(cancelled.prefix + cancelled.suffix, 0U);
+
+  // gates on blocked qubits are never cancelled
+  cancelled = ec::cancelGates(qc1, qc2, 8U, {true, false, false}, false);
+  EXPECT_EQ(cancelled.prefix, 0U);
+  EXPECT_EQ(cancelled.suffix, 0U);
+
+  config.execution.runAlternatingChecker = true;
+  config.application.cancellationWindow = 8U;
+  config.optimizations.fuseSingleQubitGates = false;
+  config.optimizations.reorderOperations = false;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_TRUE(ecm.getResults().checkerResults[0].contains("cancelled_gates"));
+
+  qc2 = qc::QuantumComputation(3U);
+  qc2.h(0);
+  qc2.h(2);
+  qc2.h(2);
+  qc2.cx(0, 1);
+  qc2.t(1);
+  qc2.cx(1, 2);
+  qc2.h(2);
+  ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  const auto& counts = ecm2.getResults().checkerResults[0]["cancelled_gates"];
+  EXPECT_EQ(counts["prefix"], 3U);
+  EXPECT_EQ(counts["suffix"], 2U);
+}
+
+TEST_F(EqualityTest, MiterSplitting) {
+  qc1 = qc::QuantumComputation(4U);
+  qc2 = qc::QuantumComputation(4U);
+  for (auto* qc : {&qc1, &qc2}) {
+    qc->h(0);
+    qc->cx(0, 1);
+    qc->cx(1, 2);
+    qc->cx(2, 3);
+  }
+  // the only difference between both circuits
+  qc1.swap(1, 2);
+  qc2.cx(1, 2);
+  qc2.cx(2, 1);
+  qc2.cx(1, 2);
+  for (auto* qc : {&qc1, &qc2}) {
+    qc->t(3);
+    qc->h(1);
+    qc->cx(3, 0);
+    qc->s(2);
+  }
+
+  const auto regions = ec::MiterSplittingChecker::split(qc1, qc2);
+  ASSERT_EQ(regions.size(), 1U);
+  EXPECT_EQ(regions[0].begin1, 4U);
+  EXPECT_EQ(regions[0].end1, 5U);
+  EXPECT_EQ(regions[0].begin2, 4U);
+  EXPECT_EQ(regions[0].end2, 7U);
+  EXPECT_TRUE(ec::MiterSplittingChecker::split(qc1, qc1).empty());
+
+  config.execution.runAlternatingChecker = true;
+  config.execution.splitMiters = true;
+  config.optimizations.reconstructSWAPs = false;
+  config.optimizations.elidePermutations = false;
+  config.optimizations.fuseSingleQubitGates = false;
+  config.optimizations.reorderOperations = false;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  const auto& results = ecm.getResults().checkerResults[0];
+  EXPECT_EQ(results["checker"], "decision_diagram_miter_splitting");
+  EXPECT_EQ(results["sub_miters"], 1U);
+  EXPECT_FALSE(results["fallback"].get<bool>());
+
+  // synchronized operations and equivalent sub-miters count as progress
+  ec::MiterSplittingChecker checker(qc1, qc2, config);
+  EXPECT_EQ(checker.getProgress(), 0.);
+  EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_DOUBLE_EQ(checker.getProgress(), 1.);
+
+  // a region that is not equivalent leads to checking the whole circuits
+  qc2.x(0);
+  ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_TRUE(ecm2.getResults().checkerResults[0]["fallback"].get<bool>());
+}
+
+TEST_F(EqualityTest, BatchOfPairs) {
+  qc1.h(0);
+  qc1.x(0);
+  qc2.z(0);
+  qc2.h(0);
+  auto qc3 = qc::QuantumComputation(nqubits);
+  qc3.h(0);
+
+  config.execution.runAlternatingChecker = true;
+  config.execution.runSimulationChecker = true;
+
+  for (const std::size_t nthreads : {1U, 2U, 16U}) {
+    config.execution.nthreads = nthreads;
+    ec::BatchEquivalenceChecker batch(config);
+    for (std::size_t i = 0U; i < 4U; ++i) {
+      EXPECT_EQ(batch.addPair(qc1, qc2), 2U * i);
+      EXPECT_EQ(batch.addPair(qc1, qc3), (2U * i) + 1U);
+    }
+
+    std::vector<bool> reported(batch.size(), false);
+    batch.run([&reported](const std::size_t index, const auto& results) {
+      EXPECT_FALSE(reported[index]);
+      reported[index] = true;
+      EXPECT_EQ(results.consideredEquivalent(), index % 2U == 0U);
+    });
+    EXPECT_TRUE(std::all_of(reported.begin(), reported.end(),
+                            [](const bool r) { return r; }));
+
+    for (std::size_t i = 0U; i < batch.size(); ++i) {
+      if (i % 2U == 0U) {
+        EXPECT_TRUE(batch.getResults(i).consideredEquivalent());
+      } else {
+        EXPECT_EQ(batch.getResults(i).equivalence,
+                  ec::EquivalenceCriterion::NotEquivalent);
+      }
+    }
+  }
+}
+
+TEST_F(EqualityTest, NumericalToleranceLock) {
+  std::mutex mutex{};
+  std::condition_variable cond{};
+  bool waiting = false;
+  std::atomic<bool> released{false};
+  std::thread other{};
+  {
+    const ec::NumericalToleranceLock lock(1e-10);
+    EXPECT_EQ(dd::RealNumber::eps, 1e-10);
+    {
+      // checks with the same tolerance may hold the lock concurrently
+      const ec::NumericalToleranceLock same(1e-10);
+    }
+
+    // a check with another tolerance has to wait until the lock is released
+    other = std::thread([&] {
+      {
+        const std::lock_guard guard(mutex);
+        waiting = true;
+      }
+      cond.notify_one();
+      const ec::NumericalToleranceLock otherLock(1e-12);
+      EXPECT_TRUE(released);
+      EXPECT_EQ(dd::RealNumber::eps, 1e-12);
+    });
+    std::unique_lock guard(mutex);
+    cond.wait(guard, [&waiting] { return waiting; });
+    EXPECT_EQ(dd::RealNumber::eps, 1e-10);
+    released = true;
+  }
+  other.join();
+
+  // managers with different tolerances can be run from multiple threads
+  qc1.h(0);
+  qc1.x(0);
+  qc2.z(0);
+  qc2.h(0);
+  config.execution.runAlternatingChecker = true;
+  std::vector<std::thread> threads{};
+  std::atomic<std::size_t> equivalent{0U};
+  for (std::size_t i = 0U; i < 4U; ++i) {
+    threads.emplace_back([this, i, &equivalent] {
+      auto threadConfig = config;
+      threadConfig.execution.numericalTolerance = i % 2U == 0U ? 1e-10 : 1e-12;
+      for (std::size_t j = 0U; j < 8U; ++j) {
+        ec::EquivalenceCheckingManager ecm(qc1, qc2, threadConfig);
+        ecm.run();
+        if (ecm.getResults().consideredEquivalent()) {
+          ++equivalent;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(equivalent, 32U);
+}
+
 TEST_F(EqualityTest, BothCircuitsEmptyAlternatingChecker) {
   config.execution.runAlternatingChecker = true;
   ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
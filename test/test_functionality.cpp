@@ -10,11 +10,14 @@
 
 #include "Configuration.hpp"
 #include "EquivalenceCheckingManager.hpp"
+#include "checker/dd/GarbageCollectionPolicy.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/simulation/StateType.hpp"
+#include "ir/Definitions.hpp"
 #include "ir/QuantumComputation.hpp"
 #include "qasm3/Importer.hpp"
 
+#include <cstddef>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <sstream>
@@ -96,6 +99,26 @@ TEST_P(FunctionalityTest, Lookahead) {
   EXPECT_TRUE(ecm.getResults().consideredEquivalent());
 }
 
+TEST_P(FunctionalityTest, LookaheadSearch) {
+  config.execution.runAlternatingChecker = true;
+  config.application.alternatingScheme = ec::ApplicationSchemeType::Lookahead;
+
+  for (const auto depth : {2U, 4U}) {
+    for (const auto beamWidth : {0U, 2U}) {
+      for (const auto estimate : {false, true}) {
+        config.application.lookaheadDepth = depth;
+        config.application.lookaheadBeamWidth = beamWidth;
+        config.application.lookaheadSizeEstimate = estimate;
+        ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+        ecm.run();
+        EXPECT_TRUE(ecm.getResults().consideredEquivalent())
+            << "depth: " << depth << ", beam width: " << beamWidth
+            << ", estimate: " << estimate;
+      }
+    }
+  }
+}
+
 TEST_P(FunctionalityTest, Naive) {
   config.execution.runAlternatingChecker = true;
   config.application.alternatingScheme = ec::ApplicationSchemeType::OneToOne;
@@ -106,6 +129,87 @@ TEST_P(FunctionalityTest, Naive) {
   EXPECT_TRUE(ecm.getResults().consideredEquivalent());
 }
 
+TEST_P(FunctionalityTest, GateCache) {
+  // a tiny cache makes sure that entries are also evicted
+  config.execution.gateCacheSize = 4U;
+  config.execution.runAlternatingChecker = true;
+  config.execution.runConstructionChecker = true;
+  config.execution.runSimulationChecker = true;
+
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  std::cout << ecm.getResults() << "\n";
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+
+  config.application.alternatingScheme = ec::ApplicationSchemeType::Lookahead;
+  ec::EquivalenceCheckingManager ecm2(qcOriginal, qcAlternative, config);
+  ecm2.run();
+  EXPECT_TRUE(ecm2.getResults().consideredEquivalent());
+  for (const auto& checker : ecm2.getResults().checkerResults) {
+    EXPECT_TRUE(checker.contains("gate_cache"));
+  }
+}
+
+TEST_F(FunctionalityTest, GateCacheStatistics) {
+  // every gate is repeated shortly after its first occurrence (hits), while
+  // the circuit contains more distinct gates than the cache holds (evictions)
+  constexpr std::size_t nqubits = 4U;
+  qcOriginal = qc::QuantumComputation(nqubits);
+  for (std::size_t i = 0U; i < nqubits; ++i) {
+    const auto target = static_cast<qc::Qubit>(i);
+    const auto control = static_cast<qc::Qubit>((i + 1U) % nqubits);
+    qcOriginal.h(target);
+    qcOriginal.cx(control, target);
+    qcOriginal.h(target);
+  }
+  qcAlternative = qcOriginal;
+
+  config.execution.gateCacheSize = 4U;
+  config.execution.runAlternatingChecker = true;
+  config.execution.runConstructionChecker = true;
+  config.execution.runSimulationChecker = true;
+  config.optimizations.fuseSingleQubitGates = false;
+
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+  for (const auto& checker : ecm.getResults().checkerResults) {
+    ASSERT_TRUE(checker.contains("gate_cache"));
+    const auto& cache = checker["gate_cache"];
+    EXPECT_GT(cache["hits"].get<std::size_t>(), 0U);
+    EXPECT_GT(cache["evictions"].get<std::size_t>(), 0U);
+    EXPECT_LE(cache["size"].get<std::size_t>(), 4U);
+  }
+}
+
+TEST_P(FunctionalityTest, GarbageCollectionPolicies) {
+  config.execution.runAlternatingChecker = true;
+  config.execution.runConstructionChecker = true;
+  config.execution.runSimulationChecker = true;
+  config.execution.runZXChecker = false;
+  // small thresholds make sure that collections are actually triggered
+  config.execution.gcInterval = 1U;
+  config.execution.gcLoadFactor = 0.;
+  config.execution.gcHighWaterMark = 0U;
+
+  for (const auto policy : {ec::GarbageCollectionPolicy::Periodic,
+                            ec::GarbageCollectionPolicy::LoadFactor,
+                            ec::GarbageCollectionPolicy::HighWaterMark,
+                            ec::GarbageCollectionPolicy::Adaptive}) {
+    config.execution.gcPolicy = policy;
+    ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+    ecm.run();
+    EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+    for (const auto& checker : ecm.getResults().checkerResults) {
+      ASSERT_TRUE(checker.contains("garbage_collection"));
+      EXPECT_EQ(checker["garbage_collection"]["policy"], ec::toString(policy));
+      EXPECT_GT(
+          checker["garbage_collection"]["collections"].get<std::size_t>(), 0U)
+          << ec::toString(policy);
+    }
+  }
+}
+
 TEST_P(FunctionalityTest, Simulation) {
   config.execution.runSimulationChecker = true;
 
@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 #include <iostream>
+#include <sstream>
+#include <string>
 
 class SimulationTest : public ::testing::Test {
 protected:
@@ -179,6 +181,76 @@ TEST_F(SimulationTest, GlobalStimuliParallel) {
   EXPECT_FALSE(ecm2.getResults().consideredEquivalent());
 }
 
+TEST_F(SimulationTest, PersistentWorkersParallel) {
+  config.execution.parallel = true;
+  config.execution.nthreads = 3U;
+  config.simulation.persistentWorkers = true;
+  qcOriginal = qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_alternative.qasm");
+
+  config.simulation.stateType = ec::StateType::Random1QBasis;
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  std::cout << "Results:\n" << ecm.getResults() << '\n';
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+  EXPECT_EQ(ecm.getResults().startedSimulations, config.simulation.maxSims);
+  EXPECT_EQ(ecm.getResults().performedSimulations, config.simulation.maxSims);
+
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_erroneous.qasm");
+  ec::EquivalenceCheckingManager ecm2(qcOriginal, qcAlternative, config);
+  ecm2.run();
+  std::cout << "Results (expected non-equivalent):\n"
+            << ecm2.getResults() << '\n';
+  EXPECT_FALSE(ecm2.getResults().consideredEquivalent());
+
+  // persistent workers ignore an adaptive stimulus count (with a warning)
+  config.simulation.adaptiveSims = true;
+  config.simulation.initialSims = 1U;
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_alternative.qasm");
+  std::ostringstream log{};
+  auto* const clogBuffer = std::clog.rdbuf(log.rdbuf());
+  ec::EquivalenceCheckingManager ecm3(qcOriginal, qcAlternative, config);
+  ecm3.run();
+  std::clog.rdbuf(clogBuffer);
+  EXPECT_NE(log.str().find("adaptive simulations are not supported"),
+            std::string::npos);
+  EXPECT_TRUE(ecm3.getResults().consideredEquivalent());
+  EXPECT_EQ(ecm3.getResults().performedSimulations, config.simulation.maxSims);
+}
+
+TEST_F(SimulationTest, BatchedStimuli) {
+  config.simulation.batchSize = 3U;
+  qcOriginal = qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_alternative.qasm");
+
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  std::cout << "Results:\n" << ecm.getResults() << '\n';
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+  EXPECT_EQ(ecm.getResults().performedSimulations, config.simulation.maxSims);
+
+  // the parallel flow distributes the batches over the available threads
+  ecm.reset();
+  ecm.getConfiguration().execution.parallel = true;
+  ecm.getConfiguration().execution.nthreads = 2U;
+  ecm.run();
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+  EXPECT_EQ(ecm.getResults().performedSimulations, config.simulation.maxSims);
+
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_erroneous.qasm");
+  ec::EquivalenceCheckingManager ecm2(qcOriginal, qcAlternative, config);
+  ecm2.run();
+  std::cout << "Results (expected non-equivalent):\n"
+            << ecm2.getResults() << '\n';
+  EXPECT_FALSE(ecm2.getResults().consideredEquivalent());
+  EXPECT_NE(ecm2.getResults().cexInput.p, nullptr);
+}
+
 TEST_F(SimulationTest, GlobalStimuliAncillaryQubit) {
   qcOriginal = qc::QuantumComputation(1);
   qcOriginal.addAncillaryRegister(1);
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "StopToken.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(StopToken, LinkedStopSource) {
+  ec::StopSource parent{};
+  ec::StopSource other{};
+  ec::StopSource linked({parent.getToken(), other.getToken()});
+  const auto token = linked.getToken();
+  EXPECT_FALSE(token.stopRequested());
+
+  // a stop of the linked source does not propagate to its parents
+  ec::StopSource child({parent.getToken()});
+  child.requestStop();
+  EXPECT_TRUE(child.stopRequested());
+  EXPECT_FALSE(parent.stopRequested());
+  EXPECT_FALSE(token.stopRequested());
+
+  // a stop of any parent stops the linked source
+  other.requestStop();
+  EXPECT_TRUE(token.stopRequested());
+  EXPECT_TRUE(linked.stopRequested());
+  EXPECT_FALSE(parent.stopRequested());
+
+  // default-constructed tokens are never stopped
+  ec::StopSource detached({ec::StopToken{}});
+  EXPECT_FALSE(detached.stopRequested());
+}
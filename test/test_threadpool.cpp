@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "ThreadPool.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPool, ParallelFor) {
+  ec::ThreadPool pool(3U);
+  constexpr std::size_t n = 1000U;
+  std::vector<std::atomic<std::size_t>> visits(n);
+  pool.parallelFor(8U, n, [&visits](const std::size_t i) { ++visits[i]; });
+  for (const auto& visit : visits) {
+    EXPECT_EQ(visit.load(), 1U);
+  }
+
+  // empty loops and loops without helpers run on the calling thread
+  pool.parallelFor(2U, 0U, [](std::size_t) { FAIL(); });
+  std::size_t sum = 0U;
+  pool.parallelFor(0U, 10U, [&sum](const std::size_t i) { sum += i; });
+  EXPECT_EQ(sum, 45U);
+}
+
+TEST(ThreadPool, ParallelForFromOccupiedPool) {
+  // every worker runs a loop of its own. Since helpers only take part in a
+  // loop once a worker is free, the loops do not wait for each other.
+  ec::ThreadPool pool(2U);
+  std::atomic<std::size_t> iterations{0U};
+  std::vector<std::future<void>> futures{};
+  for (std::size_t i = 0U; i < 2U; ++i) {
+    futures.emplace_back(pool.submit([&pool, &iterations] {
+      pool.parallelFor(2U, 100U, [&iterations](std::size_t) { ++iterations; });
+    }));
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+  EXPECT_EQ(iterations.load(), 200U);
+}
+
+TEST(ThreadPool, ParallelForException) {
+  ec::ThreadPool pool(2U);
+  EXPECT_THROW(pool.parallelFor(2U, 100U,
+                                [](const std::size_t i) {
+                                  if (i == 10U) {
+                                    throw std::runtime_error("failure");
+                                  }
+                                }),
+               std::runtime_error);
+  // the pool remains usable afterwards
+  std::atomic<std::size_t> iterations{0U};
+  pool.parallelFor(2U, 10U, [&iterations](std::size_t) { ++iterations; });
+  EXPECT_EQ(iterations.load(), 10U);
+}
+
+TEST(ThreadPool, SharedBetweenManagers) {
+  qc::QuantumComputation qc1(1U);
+  qc1.h(0);
+  qc1.x(0);
+  qc::QuantumComputation qc2(1U);
+  qc2.z(0);
+  qc2.h(0);
+
+  ec::Configuration config{};
+  config.execution.runAlternatingChecker = true;
+  config.execution.runSimulationChecker = true;
+  config.execution.runConstructionChecker = true;
+  config.execution.nthreads = 4U;
+
+  const auto pool = std::make_shared<ec::ThreadPool>(2U);
+  ec::EquivalenceCheckingManager ecm1(qc1, qc2, config);
+  ec::EquivalenceCheckingManager ecm2(qc1, qc1, config);
+  ecm1.setThreadPool(pool);
+  ecm2.setThreadPool(pool);
+
+  // the pool is kept alive and reused across consecutive runs
+  for (std::size_t i = 0U; i < 3U; ++i) {
+    ecm1.reset();
+    ecm2.reset();
+    ecm1.run();
+    ecm2.run();
+    EXPECT_TRUE(ecm1.getResults().consideredEquivalent());
+    EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  }
+  EXPECT_EQ(ecm1.getThreadPool(), pool);
+  EXPECT_EQ(pool->size(), 2U);
+}
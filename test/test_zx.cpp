@@ -11,18 +11,26 @@
 #include "Configuration.hpp"
 #include "EquivalenceCheckingManager.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "checker/zx/CompactMiter.hpp"
+#include "checker/zx/MiterConstruction.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/Permutation.hpp"
 #include "ir/QuantumComputation.hpp"
 #include "ir/operations/Control.hpp"
 #include "qasm3/Importer.hpp"
+#include "zx/FunctionalityConstruction.hpp"
 #include "zx/ZXDefinitions.hpp"
+#include "zx/ZXDiagram.hpp"
 
+#include <cstddef>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 class ZXTest : public testing::TestWithParam<std::string> {
 protected:
@@ -409,3 +417,153 @@ TEST_F(ZXTest, TwoQubitRotations) {
   EXPECT_EQ(ecm->getResults().equivalence,
             ec::EquivalenceCriterion::Equivalent);
 }
+
+namespace {
+// a random Clifford+T circuit and an equivalent circuit in which the
+// direction of all CNOTs is reversed
+std::pair<qc::QuantumComputation, qc::QuantumComputation>
+randomCliffordTPair(const std::size_t nqubits, const std::size_t ngates) {
+  auto qc1 = qc::QuantumComputation(nqubits);
+  auto qc2 = qc::QuantumComputation(nqubits);
+  std::mt19937_64 mt(42U);
+  std::uniform_int_distribution<qc::Qubit> qubit(
+      0U, static_cast<qc::Qubit>(nqubits - 1U));
+  std::uniform_int_distribution<std::size_t> gate(0U, 3U);
+  for (std::size_t i = 0U; i < ngates; ++i) {
+    const auto q = qubit(mt);
+    switch (gate(mt)) {
+    case 0U:
+      qc1.h(q);
+      qc2.h(q);
+      break;
+    case 1U:
+      qc1.s(q);
+      qc2.s(q);
+      break;
+    case 2U:
+      qc1.t(q);
+      qc2.t(q);
+      break;
+    default: {
+      const auto n = static_cast<qc::Qubit>(nqubits);
+      const auto t = (q + 1U + (qubit(mt) % (n - 1U))) % n;
+      qc1.cx(q, t);
+      qc2.h(q);
+      qc2.h(t);
+      qc2.cx(t, q);
+      qc2.h(q);
+      qc2.h(t);
+      break;
+    }
+    }
+  }
+  return {std::move(qc1), std::move(qc2)};
+}
+} // namespace
+
+TEST_F(ZXTest, LargeCliffordTCircuit) {
+  const auto [qc1, qc2] = randomCliffordTPair(16U, 2000U);
+  config.execution.parallel = false;
+  ecm = std::make_unique<ec::EquivalenceCheckingManager>(qc1, qc2, config);
+
+  ecm->run();
+  EXPECT_EQ(ecm->getResults().equivalence,
+            ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(ZXTest, ParallelSimplification) {
+  const auto [qc1, qc2] = randomCliffordTPair(16U, 2000U);
+  config.execution.parallel = false;
+  config.execution.zxThreads = 4U;
+  ecm = std::make_unique<ec::EquivalenceCheckingManager>(qc1, qc2, config);
+
+  ecm->run();
+  EXPECT_EQ(ecm->getResults().equivalence,
+            ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(ZXTest, EarlyMiswiring) {
+  auto [qc1, qc2] = randomCliffordTPair(8U, 1000U);
+  qc2.outputPermutation[0] = 1;
+  qc2.outputPermutation[1] = 0;
+  config.execution.parallel = false;
+  ecm = std::make_unique<ec::EquivalenceCheckingManager>(qc1, qc2, config);
+
+  ecm->run();
+  EXPECT_EQ(ecm->getResults().equivalence,
+            ec::EquivalenceCriterion::ProbablyNotEquivalent);
+}
+
+TEST_F(ZXTest, CompactMiterMirrorsDiagram) {
+  const auto qc = randomCliffordTPair(8U, 2000U).first;
+  auto diag = zx::FunctionalityConstruction::buildFunctionality(&qc);
+  ec::CompactMiter compact{};
+  compact.rebuild(diag);
+
+  const auto expectMirrored = [&]() {
+    for (zx::Vertex v = 0U; v < compact.size(); ++v) {
+      ASSERT_EQ(compact.isDeleted(v), diag.isDeleted(v));
+      if (diag.isDeleted(v)) {
+        continue;
+      }
+      EXPECT_EQ(compact.type(v), diag.type(v));
+      const auto& edges = diag.incidentEdges(v);
+      ASSERT_EQ(compact.degree(v), edges.size());
+      for (std::size_t k = 0U; k < edges.size(); ++k) {
+        EXPECT_EQ(compact.target(compact.offset(v) + k), edges[k].to);
+        EXPECT_EQ(compact.edgeType(compact.offset(v) + k), edges[k].type);
+      }
+    }
+  };
+  expectMirrored();
+
+  // delete every other spider, connect its neighbours instead, and only update
+  // the changed vertices
+  std::vector<zx::Vertex> spiders{};
+  for (const auto& [v, data] : diag.getVertices()) {
+    if (data.type != zx::VertexType::Boundary) {
+      spiders.emplace_back(v);
+    }
+  }
+  for (std::size_t i = 0U; i < spiders.size(); i += 2U) {
+    const auto v = spiders[i];
+    const auto neighbors = diag.getNeighbors(v);
+    diag.removeVertex(v);
+    for (std::size_t j = 1U; j < neighbors.size(); ++j) {
+      if (!diag.isBoundaryVertex(neighbors[0]) &&
+          !diag.isBoundaryVertex(neighbors[j]) &&
+          !diag.connected(neighbors[0], neighbors[j])) {
+        diag.addEdge(neighbors[0], neighbors[j], zx::EdgeType::Hadamard);
+      }
+    }
+    compact.update(diag, v);
+    for (const auto w : neighbors) {
+      compact.update(diag, w);
+    }
+  }
+  expectMirrored();
+}
+
+TEST_F(ZXTest, StreamedMiterConstruction) {
+  auto qc = qc::QuantumComputation(3U);
+  qc.h(0);
+  qc.cx(0, 2);
+  qc.t(1);
+  qc.setLogicalQubitAncillary(2);
+
+  const auto miter = ec::MiterConstruction::build(qc, qc);
+  const auto& outputs = miter.diagram.getOutputs();
+  ASSERT_EQ(miter.diagram.getInputs().size(), 2U);
+  ASSERT_EQ(outputs.size(), 2U);
+  for (std::size_t i = 0U; i < outputs.size(); ++i) {
+    EXPECT_EQ(miter.outputQubits.at(outputs[i]), static_cast<zx::Qubit>(i));
+  }
+
+  qcOriginal = qc;
+  qcAlternative = qc;
+  config.execution.parallel = false;
+  ecm = std::make_unique<ec::EquivalenceCheckingManager>(qcOriginal,
+                                                         qcAlternative, config);
+  ecm->run();
+  EXPECT_TRUE(ecm->getResults().consideredEquivalent());
+}